@@ -4,10 +4,12 @@
 #include "structures/dynamic_array.h"
 #include "structures/stack.h"
 #include "rpn.h"
+#include "benchmark.h"
 #include <vector>
 
 #include <iostream>
 #include <iomanip>
+#include <limits>
 
 /**
  * Reads the number input via cin
@@ -44,6 +46,7 @@ int TApplication::execute() {
         std::cout << "2. Dynamic array\n";
         std::cout << "3. Stack\n";
         std::cout << "4. Reverse Polish Notation\n";
+        std::cout << "5. Benchmarks\n";
 
         // Get command from the keyboard
         if (!menu(userChoice)) continue; // Error occurred
@@ -64,6 +67,9 @@ int TApplication::execute() {
         } else if (userChoice == '4') {
             std::cout << "Polish Notation thread executed.\n";
             executeRPN();
+        } else if (userChoice == '5') {
+            std::cout << "Benchmark thread executed. Enter 'h' to get list of benchmarks\n";
+            executeBench();
         } else {
             std::cout << "RuntimeError. Unknown command\n";
         }
@@ -78,7 +84,7 @@ int TApplication::execute() {
 /// Execute the list thread
 int TApplication::executeList() {
     char userChoice;
-    List list;
+    List<int> list;
 
     while (true) {
         // Get command from the keyboard
@@ -99,7 +105,7 @@ int TApplication::executeList() {
                     if (!inputNumber<int>(el)) break;
 
                 // Create the list
-                list = List(size, values);
+                list = List<int>(size, values);
                 std::cout << "Created list: " << list << std::endl;
 
                 break;
@@ -124,7 +130,7 @@ int TApplication::executeList() {
                     std::cout << "<< Enter the index:\n>> ";
                     if (!inputNumber(index, true, false)) break;
 
-                    struct Node *element = list[index];
+                    auto *element = list[index];
                     if (element) std::cout << "Element " << element->value << " found\n";
                     else std::cout << "Element not found\n";
                 } else if (choice == 2) {
@@ -203,6 +209,13 @@ int TApplication::executeList() {
                 break;
             }
 
+            // Toggle positional index
+            case '7': {
+                list.setIndexed(!list.isIndexed());
+                std::cout << "Positional index " << (list.isIndexed() ? "enabled" : "disabled") << std::endl;
+                break;
+            }
+
             // Help menu
             case 'h': {
                 helpList();
@@ -222,7 +235,7 @@ int TApplication::executeList() {
 /// Execute the dynamic array thread
 int TApplication::executeDArr() {
     char userChoice;
-    DArray arr;
+    DArray<int> arr;
 
     while (true) {
         // Get command from the keyboard
@@ -243,7 +256,7 @@ int TApplication::executeDArr() {
                     if (!inputNumber(el)) break;
 
                 // Reassign the array
-                arr = DArray(size, values);
+                arr = DArray<int>(size, values);
                 std::cout << "Created array: " << arr << std::endl;
 
                 break;
@@ -352,7 +365,7 @@ int TApplication::executeDArr() {
 /// Execute the dynamic array thread
 int TApplication::executeStack() {
     char userChoice;
-    Stack stack;
+    Stack<std::string> stack;
 
     while (true) {
         // Get command from the keyboard
@@ -420,14 +433,15 @@ int TApplication::executeRPN() {
             }
 
             // Get RPN and evaluate
-            std::vector<std::string> rpn = toRPN(expr, isDebugMode);
+            std::vector<Token> rpn = toRPN(expr, isDebugMode);
             double rpnAnswer = evaluate(rpn, isDebugMode);
 
             // Output
             std::cout << std::setw(64) << std::setfill('-') << ' ' << std::setfill(' ');
             std::cout << "\n Input: " << expr << "\n   RPN: ";
             for (auto &token : rpn) std::cout << token << ' ';
-            std::cout << "\nAnswer: " << rpnAnswer << std::endl;
+            std::cout << "\nAnswer: " << std::setprecision(std::numeric_limits<double>::max_digits10) << rpnAnswer;
+            std::cout << std::setprecision(6) << std::endl;
         }
         catch (std::invalid_argument& e) { std::cerr << "Invalid argument. " << e.what() << std::endl; }
         catch (std::runtime_error& e) { std::cerr << "Runtime error. " << e.what() << std::endl; }
@@ -437,6 +451,195 @@ int TApplication::executeRPN() {
 }
 
 
+/// Execute the benchmark thread
+int TApplication::executeBench() {
+    char userChoice;
+
+    while (true) {
+        // Get command from the keyboard
+        if (!menu(userChoice)) continue; // Error occurred
+        if (userChoice == '0') break;
+
+        // Execute
+        switch (userChoice) {
+            // List vs Unrolled list
+            case '1': {
+                unsigned size, queries;
+                std::cout << "<< Enter the size of the lists:\n>> ";
+                if (!inputNumber(size, true, true) || size == 0) break;
+                std::cout << "<< Enter the amount of queries:\n>> ";
+                if (!inputNumber(queries, true, true)) break;
+
+                benchmarkUnrolledList(size, queries);
+                break;
+            }
+
+            // List vs Compact list
+            case '2': {
+                unsigned size;
+                std::cout << "<< Enter the size of the lists:\n>> ";
+                if (!inputNumber(size, true, true) || size == 0) break;
+
+                benchmarkCompactList(size);
+                break;
+            }
+
+            // Concurrent list
+            case '3': {
+                unsigned size;
+                std::cout << "<< Enter the amount of values per producer:\n>> ";
+                if (!inputNumber(size, true, true) || size == 0) break;
+
+                benchmarkConcurrentList(size);
+                break;
+            }
+
+            // Bulk construction of List
+            case '4': {
+                unsigned size;
+                std::cout << "<< Enter the size of the lists:\n>> ";
+                if (!inputNumber(size, true, true) || size == 0) break;
+
+                benchmarkBulkList(size);
+                break;
+            }
+
+            // DArray append
+            case '5': {
+                unsigned size;
+                std::cout << "<< Enter the amount of elements:\n>> ";
+                if (!inputNumber(size, true, true) || size == 0) break;
+
+                benchmarkDArray(size);
+                break;
+            }
+
+            // SIMD search kernels
+            case '6': {
+                unsigned size;
+                std::cout << "<< Enter the size of the array:\n>> ";
+                if (!inputNumber(size, true, true) || size == 0) break;
+
+                benchmarkSimdSearch(size);
+                break;
+            }
+
+            // Many small arrays
+            case '7': {
+                unsigned count;
+                std::cout << "<< Enter the amount of the arrays:\n>> ";
+                if (!inputNumber(count, true, true) || count == 0) break;
+
+                benchmarkSmallDArray(count);
+                break;
+            }
+
+            // File-backed array
+            case '8': {
+                unsigned size;
+                std::cout << "<< Enter the size of the array:\n>> ";
+                if (!inputNumber(size, true, true) || size == 0) break;
+
+                benchmarkMappedDArray(size);
+                break;
+            }
+
+            // Gap buffer edits
+            case '9': {
+                unsigned size;
+                std::cout << "<< Enter the size of the array:\n>> ";
+                if (!inputNumber(size, true, true) || size == 0) break;
+
+                benchmarkGapBuffer(size);
+                break;
+            }
+
+            // Segmented array growth
+            case 'a': {
+                unsigned size;
+                std::cout << "<< Enter the size of the array:\n>> ";
+                if (!inputNumber(size, true, true) || size == 0) break;
+
+                benchmarkSegmentedDArray(size);
+                break;
+            }
+
+            // Parallel bulk algorithms
+            case 'b': {
+                unsigned size;
+                std::cout << "<< Enter the size of the array:\n>> ";
+                if (!inputNumber(size, true, true) || size == 0) break;
+
+                benchmarkParallel(size);
+                break;
+            }
+
+            // Sorted array search
+            case 'c': {
+                unsigned size;
+                std::cout << "<< Enter the size of the array:\n>> ";
+                if (!inputNumber(size, true, true) || size == 0) break;
+
+                benchmarkSortedDArray(size);
+                break;
+            }
+
+            // Copy-on-write fan-out
+            case 'd': {
+                unsigned size;
+                std::cout << "<< Enter the size of the array:\n>> ";
+                if (!inputNumber(size, true, true) || size == 0) break;
+
+                benchmarkSharedDArray(size);
+                break;
+            }
+
+            // Range queries
+            case 'e': {
+                unsigned size;
+                std::cout << "<< Enter the size of the array:\n>> ";
+                if (!inputNumber(size, true, true) || size == 0) break;
+
+                benchmarkRangeIndex(size);
+                break;
+            }
+
+            // Lock-free stack
+            case 'f': {
+                unsigned size;
+                std::cout << "<< Enter the amount of push/pop pairs per thread:\n>> ";
+                if (!inputNumber(size, true, true) || size == 0) break;
+
+                benchmarkConcurrentStack(size);
+                break;
+            }
+
+            // Polish notation
+            case 'g': {
+                unsigned size;
+                std::cout << "<< Enter the length of the expression:\n>> ";
+                if (!inputNumber(size, true, true) || size == 0) break;
+
+                benchmarkRPN(size);
+                break;
+            }
+
+            // Help menu
+            case 'h': {
+                helpBench();
+                break;
+            }
+
+            // Runtime error. Unknown command
+            default: std::cout << "Runtime error. Unknown command\n";
+        }
+        system("pause");
+    }
+
+    return 0;
+}
+
+
 /// Print available List commands
 void TApplication::helpList() {
     std::cout << "Available commands:\n";
@@ -449,6 +652,7 @@ void TApplication::helpList() {
     std::cout << "4: Add new node\n";
     std::cout << "5: Delete existing node\n";
     std::cout << "6: Swap two elements\n";
+    std::cout << "7: Toggle positional index\n";
     std::cout << std::setw(32) << std::setfill('-') << '\n';
     std::cout << "0: Exit\n";
     std::cout << std::setw(32) << std::setfill('-') << '\n';
@@ -490,6 +694,35 @@ void TApplication::helpStack() {
 }
 
 
+/// Print available benchmarks
+void TApplication::helpBench() {
+    std::cout << "Available benchmarks:\n";
+    std::cout << std::setw(32) << std::setfill('-') << '\n';
+    std::cout << "h: Help (this menu)\n";
+    std::cout << std::setw(32) << std::setfill('-') << '\n';
+    std::cout << "1: List vs Unrolled list\n";
+    std::cout << "2: List vs Compact list\n";
+    std::cout << "3: Concurrent list (stress & throughput)\n";
+    std::cout << "4: List append vs bulk construction\n";
+    std::cout << "5: Dynamic array append\n";
+    std::cout << "6: Dynamic array SIMD search\n";
+    std::cout << "7: Dynamic array vs small dynamic array\n";
+    std::cout << "8: Memory-mapped dynamic array\n";
+    std::cout << "9: Gap buffer vs dynamic array edits\n";
+    std::cout << "a: Segmented vs dynamic array growth\n";
+    std::cout << "b: Parallel bulk algorithms scaling\n";
+    std::cout << "c: Sorted array search\n";
+    std::cout << "d: Copy-on-write array fan-out\n";
+    std::cout << "e: Range index vs array scan\n";
+    std::cout << "f: Lock-free stack (throughput & linearizability)\n";
+    std::cout << "g: Polish notation lexing and evaluation\n";
+    std::cout << std::setw(32) << std::setfill('-') << '\n';
+    std::cout << "0: Exit\n";
+    std::cout << std::setw(32) << std::setfill('-') << '\n';
+    std::cout << std::setfill(' ');
+}
+
+
 /**
  * Prints the menu of commands and reads the user action input via cin
  * @param[out] userChoice Reference to a declared user's choice variable
@@ -9,10 +9,12 @@ private:
     static int executeDArr();  // Execute the dynamic array thread
     static int executeStack(); // Execute the stack thread
     static int executeRPN();   // Execute the polish notation thread
+    static int executeBench(); // Execute the benchmark thread
 
     static void helpList();    // Print the available list commands
     static void helpDArr();    // Print the available dynamic array commands
     static void helpStack();   // Print the available stack commands
+    static void helpBench();   // Print the available benchmarks
 
     static bool menu(char&);   // Wait for user's choice
 };
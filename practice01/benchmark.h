@@ -0,0 +1,826 @@
+#ifndef PRACTICE01_BENCHMARK_H
+#define PRACTICE01_BENCHMARK_H
+
+
+#include "structures/dl_list.h"
+#include "structures/unrolled_list.h"
+#include "structures/compact_list.h"
+#include "structures/concurrent_list.h"
+#include "structures/concurrent_stack.h"
+#include "structures/stack.h"
+#include "structures/dynamic_array.h"
+#include "structures/mapped_array.h"
+#include "structures/gap_buffer.h"
+#include "structures/segmented_array.h"
+#include "structures/parallel.h"
+#include "structures/sorted_array.h"
+#include "structures/shared_array.h"
+#include "structures/range_index.h"
+#include "rpn.h"
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <memory>
+#include <filesystem>
+#include <fstream>
+
+#include <iostream>
+#include <iomanip>
+
+
+/// Run the function and return the elapsed time in seconds
+template <typename Func>
+double measure(Func &&func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / 1e9;
+}
+
+
+/// Print one row of the benchmark table: name and elapsed time of each contestant
+void printRow(const std::string &name, std::initializer_list<double> seconds) {
+    std::cout << std::left << std::setw(16) << name << std::right << std::scientific << std::setprecision(2);
+    for (double s : seconds) std::cout << std::setw(12) << s;
+    std::cout << std::defaultfloat << std::endl;
+}
+
+
+/// Generate the vector of random values in range [0, 1e6)
+std::vector<int> randomValues(unsigned size, unsigned seed = 42) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, 999999);
+    std::vector<int> values(size);
+    for (auto &el : values) el = dist(gen);
+    return values;
+}
+
+
+/**
+ * Compare List and UnrolledList on find, indexed get and full traversal
+ * @param[in] size - amount of elements in the lists
+ * @param[in] queries - amount of find and get operations
+ */
+void benchmarkUnrolledList(unsigned size, unsigned queries) {
+    std::vector<int> values = randomValues(size);
+    std::vector<int> indexes = randomValues(queries, 7);
+    for (auto &index : indexes) index %= int(size);
+
+    List<int> list(size, values.data());
+    UnrolledList unrolled(size, values.data());
+    long long checksum[2] = {0, 0};  // Keeps the compiler from throwing the loops away
+
+    std::cout << std::left << std::setw(16) << "Operation" << std::right;
+    std::cout << std::setw(12) << "List" << std::setw(12) << "Unrolled" << std::endl;
+
+    printRow("find", {
+        measure([&] { for (int i : indexes) checksum[0] += list.find(values[i]); }),
+        measure([&] { for (int i : indexes) checksum[1] += unrolled.find(values[i]); })
+    });
+    printRow("get", {
+        measure([&] { for (int i : indexes) checksum[0] += list[i]->value; }),
+        measure([&] { for (int i : indexes) checksum[1] += *unrolled[i]; })
+    });
+    printRow("traversal", {
+        measure([&] { for (int value : list) checksum[0] += value; }),
+        measure([&] { for (int value : unrolled) checksum[1] += value; })
+    });
+
+    std::cout << "Checksums match: " << (checksum[0] == checksum[1]) << std::endl;
+}
+
+
+/**
+ * Compare List and CompactList on traversal when the nodes are scattered in memory
+ * and after CompactList::compact(). Every node is randomly added to the front or to the back
+ * @param[in] size - amount of elements in the lists
+ */
+void benchmarkCompactList(unsigned size) {
+    std::vector<int> values = randomValues(size);
+    List<int> list;
+    CompactList compact;
+    for (int value : values) {
+        if (value & 1) {
+            list.insert(list.begin(), value);
+            compact.insert(compact.begin(), value);
+        } else {
+            list.append(value);
+            compact.append(value);
+        }
+    }
+    long long checksum[2] = {0, 0};
+
+    std::cout << std::left << std::setw(16) << "Operation" << std::right;
+    std::cout << std::setw(12) << "List" << std::setw(12) << "Compact" << std::endl;
+
+    printRow("traversal", {
+        measure([&] { for (int value : list) checksum[0] += value; }),
+        measure([&] { for (int value : compact) checksum[1] += value; })
+    });
+    printRow("compact()", {0, measure([&] { compact.compact(); })});
+    printRow("traversal", {
+        measure([&] { for (int value : list) checksum[0] += value; }),
+        measure([&] { for (int value : compact) checksum[1] += value; })
+    });
+
+    std::cout << "Bytes per node: List " << sizeof(Node<int>);
+    std::cout << ", Compact " << sizeof(int) + 2 * sizeof(uint32_t) << std::endl;
+    std::cout << "Checksums match: " << (checksum[0] == checksum[1]) << std::endl;
+}
+
+
+/**
+ * Compare building List by append loop and by the bulk construction from a span with both kinds of storage
+ * @param[in] size - amount of elements in the lists
+ */
+void benchmarkBulkList(unsigned size) {
+    std::vector<int> values = randomValues(size);
+    long long checksum[2] = {0, 0};
+
+    std::cout << std::left << std::setw(16) << "Storage" << std::right;
+    std::cout << std::setw(12) << "Append" << std::setw(12) << "Bulk" << std::endl;
+
+    for (bool isPooled : {false, true}) {
+        printRow(isPooled ? "pool" : "heap", {
+            measure([&] {
+                List<int> list(0, 0, isPooled);
+                for (int value : values) list.append(value);
+                checksum[0] += list.getSize();
+            }),
+            measure([&] {
+                List<int> list(values, isPooled);
+                checksum[1] += list.getSize();
+            })
+        });
+    }
+
+    std::cout << "Checksums match: " << (checksum[0] == checksum[1]) << std::endl;
+}
+
+
+/**
+ * Compare appending to DArray and std::vector with and without reserve()
+ * @param[in] size - amount of appended elements
+ */
+void benchmarkDArray(unsigned size) {
+    long long checksum[2] = {0, 0};
+
+    std::cout << std::left << std::setw(16) << "Operation" << std::right;
+    std::cout << std::setw(12) << "DArray" << std::setw(12) << "vector" << std::endl;
+
+    for (bool isReserved : {false, true}) {
+        printRow(isReserved ? "reserve+append" : "append", {
+            measure([&] {
+                DArray<int> arr;
+                if (isReserved) arr.reserve(size);
+                for (unsigned i = 0; i < size; ++i) arr.append(int(i));
+                checksum[0] += arr.getSize();
+            }),
+            measure([&] {
+                std::vector<int> vec;
+                if (isReserved) vec.reserve(size);
+                for (unsigned i = 0; i < size; ++i) vec.push_back(int(i));
+                checksum[1] += vec.size();
+            })
+        });
+    }
+
+    std::cout << "Checksums match: " << (checksum[0] == checksum[1]) << std::endl;
+}
+
+
+/**
+ * Many tiny arrays: DArray allocates each of them, SmallDArray keeps them inline.
+ * Every array gets 1..8 elements, the inline capacity is 8
+ * @param[in] count - amount of arrays
+ */
+void benchmarkSmallDArray(unsigned count) {
+    long long checksum[2] = {0, 0};
+
+    std::cout << std::left << std::setw(16) << "Operation" << std::right;
+    std::cout << std::setw(12) << "DArray" << std::setw(12) << "SmallDArray" << std::endl;
+
+    auto build = [&](auto &arrays, long long &sum) {
+        for (unsigned i = 0; i < count; ++i)
+            for (unsigned j = 0; j <= i % 8; ++j) arrays[i].append(int(j));
+        for (unsigned i = 0; i < count; ++i) sum += arrays[i].getSize();
+    };
+
+    std::vector<DArray<int>> heap(count);
+    std::vector<SmallDArray<int, 8>> small(count);
+    printRow("build", {
+        measure([&] { build(heap, checksum[0]); }),
+        measure([&] { build(small, checksum[1]); })
+    });
+    printRow("sum", {
+        measure([&] { for (auto &arr : heap) for (int value : arr) checksum[0] += value; }),
+        measure([&] { for (auto &arr : small) for (int value : arr) checksum[1] += value; })
+    });
+    printRow("destroy", {
+        measure([&] { heap = {}; }),
+        measure([&] { small = {}; })
+    });
+
+    std::cout << "Checksums match: " << (checksum[0] == checksum[1]) << std::endl;
+}
+
+
+/**
+ * Throughput of the DArray search kernels of each instruction set in GB/s. Keys are absent,
+ * so every kernel reads the whole array. Scalar is the plain loop DArray::find used to be
+ * @param[in] size - amount of elements in the array
+ * @param[in] repeats - amount of runs of each kernel
+ */
+void benchmarkSimdSearch(unsigned size, unsigned repeats = 10) {
+    std::vector<int> values = randomValues(size);
+    DArray<int> arr(size, values.data());
+    DArray<int> keys;
+    for (int i = 1; i <= 16; ++i) keys.append(-i);
+    DArray<int> fewKeys(8, keys.data());
+    DArray<int> manyKeys;
+    for (int i = 1; i <= 1024; ++i) manyKeys.append(-i);
+    long long checksum = 0;
+    const SimdSearch::Level levels[] = {SimdSearch::Level::Scalar, SimdSearch::Level::SSE41, SimdSearch::Level::AVX2};
+    const SimdSearch::Level active = SimdSearch::getLevel();
+
+    std::cout << std::left << std::setw(16) << "GB/s" << std::right;
+    for (auto level : levels) std::cout << std::setw(12) << SimdSearch::getLevelName(level);
+    std::cout << std::endl;
+
+    auto row = [&](const std::string &name, auto &&kernel) {
+        std::cout << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(2);
+        for (auto level : levels) {
+            if (!SimdSearch::setLevel(level)) {
+                std::cout << std::setw(12) << '-';
+                continue;
+            }
+            double seconds = measure([&] { for (unsigned r = 0; r < repeats; ++r) checksum += kernel(); });
+            std::cout << std::setw(12) << double(size) * sizeof(int) * repeats / seconds / 1e9;
+        }
+        std::cout << std::defaultfloat << std::endl;
+    };
+
+    row("find", [&] { return arr.find(-1); });
+    row("count", [&] { return arr.count(-1); });
+    row("findAll", [&] { return arr.findAll(-1).getSize(); });
+    row("min", [&] { return arr.min(); });
+    row("max", [&] { return arr.max(); });
+    row("containsAny(8)", [&] { return arr.containsAny(fewKeys); });
+    row("containsAny(1k)", [&] { return arr.containsAny(manyKeys); });
+    row("findBatch(16)", [&] { return arr.findBatch(keys).getSize(); });
+    row("findBatch(1k)", [&] { return arr.findBatch(manyKeys).getSize(); });
+
+    SimdSearch::setLevel(active);
+    std::cout << "Checksum: " << checksum << std::endl;
+}
+
+
+/**
+ * Insert/remove workloads of GapBuffer and DArray. Localized edits follow a cursor that moves
+ * by a few elements between the edits, random edits go anywhere. Half of the edits are inserts
+ * @param[in] size - amount of elements before the edits
+ * @param[in] edits - amount of inserts and removes
+ */
+void benchmarkGapBuffer(unsigned size, unsigned edits = 20000) {
+    std::vector<int> values = randomValues(size);
+    long long checksum[2] = {0, 0};
+
+    std::cout << std::left << std::setw(16) << "Edits" << std::right;
+    std::cout << std::setw(12) << "GapBuffer" << std::setw(12) << "DArray" << std::endl;
+
+    // Apply the same edits to the container, the cursor stays inside [0, size)
+    auto run = [&](auto &container, bool isLocal, long long &sum) {
+        std::mt19937 generator(7);
+        unsigned cursor = size / 2;
+        for (unsigned i = 0; i < edits; ++i) {
+            if (isLocal) cursor = std::clamp(int(cursor) + int(generator() % 17) - 8, 0, int(container.getSize()) - 1);
+            else cursor = generator() % container.getSize();
+
+            if (i % 2 == 0) container.insert(cursor, int(i));
+            else container.remove(cursor);
+        }
+        for (unsigned i = 0; i < container.getSize(); i += 97) sum += *container[int(i)];
+    };
+
+    for (bool isLocal : {true, false}) {
+        GapBuffer<int> buffer(size, values.data());
+        DArray<int> arr(size, values.data());
+        printRow(isLocal ? "localized" : "random", {
+            measure([&] { run(buffer, isLocal, checksum[0]); }),
+            measure([&] { run(arr, isLocal, checksum[1]); })
+        });
+    }
+
+    std::cout << "Checksums match: " << (checksum[0] == checksum[1]) << std::endl;
+}
+
+
+/**
+ * Appends and reads of SegmentedDArray and DArray. The slowest single append shows the latency
+ * spike of DArray copying all the elements on growth, SegmentedDArray only allocates a block
+ * @param[in] size - amount of elements to append
+ */
+void benchmarkSegmentedDArray(unsigned size) {
+    std::vector<int> values = randomValues(size);
+    long long checksum[2] = {0, 0};
+    double worst[2] = {0, 0};
+
+    std::cout << std::left << std::setw(16) << "Operation" << std::right;
+    std::cout << std::setw(12) << "Segmented" << std::setw(12) << "DArray" << std::endl;
+
+    // Time every append separately and keep the slowest one
+    auto fill = [&](auto &arr, double &slowest) {
+        for (unsigned i = 0; i < size; ++i)
+            slowest = std::max(slowest, measure([&] { arr.append(int(i)); }));
+    };
+
+    SegmentedDArray<int> segmented;
+    DArray<int> arr;
+    printRow("append", {
+        measure([&] { fill(segmented, worst[0]); }),
+        measure([&] { fill(arr, worst[1]); })
+    });
+    printRow("slowest append", {worst[0], worst[1]});
+    printRow("random get", {
+        measure([&] { for (int value : values) checksum[0] += *segmented[value % int(size)]; }),
+        measure([&] { for (int value : values) checksum[1] += *arr[value % int(size)]; })
+    });
+    printRow("scan", {
+        measure([&] { for (int value : segmented) checksum[0] += value; }),
+        measure([&] { for (int value : arr) checksum[1] += value; })
+    });
+
+    std::cout << "Checksums match: " << (checksum[0] == checksum[1]) << std::endl;
+}
+
+
+/**
+ * Scaling of the parallel bulk algorithms. Every operation runs on pools of 1, 2, 4, ... threads
+ * up to the amount of cores, the first column is the serial standard algorithm
+ * @param[in] size - amount of elements in the array
+ */
+void benchmarkParallel(unsigned size) {
+    std::vector<unsigned> threads;
+    unsigned cores = std::max(std::thread::hardware_concurrency(), 1u);
+    for (unsigned count = 1; count < cores; count *= 2) threads.push_back(count);
+    threads.push_back(cores);
+
+    DArray<int> arr(size);
+    long long checksum = 0;
+
+    std::cout << std::left << std::setw(16) << "Threads" << std::right << std::setw(12) << "serial";
+    for (unsigned count : threads) std::cout << std::setw(12) << count;
+    std::cout << std::endl;
+
+    auto isEven = [](int value) { return value % 2 == 0; };
+    auto row = [&](const std::string &name, auto &&serial, auto &&parallel) {
+        std::cout << std::left << std::setw(16) << name << std::right << std::scientific << std::setprecision(2);
+        std::cout << std::setw(12) << measure(serial);
+        for (unsigned count : threads) {
+            ThreadPool pool(count);
+            std::cout << std::setw(12) << measure([&] { parallel(pool); });
+        }
+        std::cout << std::defaultfloat << std::endl;
+    };
+
+    row("fill",
+        [&] { std::fill(arr.begin(), arr.end(), 1); },
+        [&](ThreadPool &pool) { Parallel::fill(arr, 1, pool); });
+    row("transform",
+        [&] { std::transform(arr.begin(), arr.end(), arr.begin(), [](int v) { return v * 3 + 1; }); },
+        [&](ThreadPool &pool) { Parallel::transform(arr, [](int v) { return v * 3 + 1; }, pool); });
+    row("reduce",
+        [&] { checksum += std::reduce(arr.begin(), arr.end(), 0LL); },
+        [&](ThreadPool &pool) { checksum += Parallel::reduce(arr, 0, std::plus<>(), pool); });
+    row("inclusive_scan",
+        [&] { std::inclusive_scan(arr.begin(), arr.end(), arr.begin(), std::bit_xor<>()); },
+        [&](ThreadPool &pool) { Parallel::inclusive_scan(arr, std::bit_xor<>(), pool); });
+    row("count_if",
+        [&] { checksum += std::count_if(arr.begin(), arr.end(), isEven); },
+        [&](ThreadPool &pool) { checksum += Parallel::count_if(arr, isEven, pool); });
+    row("partition",
+        [&] { checksum += std::stable_partition(arr.begin(), arr.end(), isEven) - arr.begin(); },
+        [&](ThreadPool &pool) { checksum += Parallel::partition(arr, isEven, pool); });
+
+    std::cout << "Checksum: " << checksum << std::endl;
+}
+
+
+/**
+ * Membership queries against a static sorted array, in nanoseconds per query. Linear find of
+ * DArray is measured on fewer queries, it scans the whole array for the absent keys
+ * @param[in] size - amount of elements in the array
+ * @param[in] queries - amount of queries
+ */
+void benchmarkSortedDArray(unsigned size, unsigned queries = 1000000) {
+    std::vector<int> values = randomValues(size);
+    std::vector<int> keys = randomValues(queries, 7);
+    SortedDArray<int> sorted(size, values.data());
+    DArray<int> plain(size, values.data());
+    DArray<int> batch(queries, keys.data());
+    std::vector<int> binary(sorted.begin(), sorted.end());
+    unsigned linearQueries = std::min(queries, std::max(1u, 100000000u / size));
+    long long checksum[4] = {0, 0, 0, 0};
+
+    auto row = [&](const std::string &name, unsigned count, double seconds) {
+        std::cout << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(1);
+        std::cout << std::setw(12) << seconds / count * 1e9 << std::defaultfloat << std::endl;
+    };
+
+    std::cout << std::left << std::setw(16) << "Search" << std::right << std::setw(12) << "ns/query" << std::endl;
+    row("Eytzinger", queries, measure([&] { for (int key : keys) checksum[0] += sorted.contains(key); }));
+    row("Eytzinger batch", queries, measure([&] { checksum[1] += sorted.contains(batch).count(true); }));
+    row("binary search", queries, measure([&] {
+        for (int key : keys) checksum[2] += std::binary_search(binary.begin(), binary.end(), key);
+    }));
+    row("linear find", linearQueries, measure([&] {
+        for (unsigned i = 0; i < linearQueries; ++i) checksum[3] += plain.find(keys[i]) != -1;
+    }));
+
+    std::cout << "Checksums match: " << (checksum[0] == checksum[1] && checksum[1] == checksum[2]) << std::endl;
+}
+
+
+/**
+ * Fan-out of one array to many read-only consumers. DArray copies the elements for every consumer,
+ * SharedDArray copies only for the consumer that writes
+ * @param[in] size - amount of elements in the array
+ * @param[in] consumers - amount of copies
+ */
+void benchmarkSharedDArray(unsigned size, unsigned consumers = 16) {
+    std::vector<int> values = randomValues(size);
+    DArray<int> plain(size, values.data());
+    SharedDArray<int> shared(size, values.data());
+    long long checksum[2] = {0, 0};
+
+    std::cout << std::left << std::setw(16) << "Operation" << std::right;
+    std::cout << std::setw(12) << "Shared" << std::setw(12) << "DArray" << std::endl;
+
+    std::vector<DArray<int>> plainCopies;
+    std::vector<SharedDArray<int>> sharedCopies;
+    printRow("copies", {
+        measure([&] { for (unsigned i = 0; i < consumers; ++i) sharedCopies.push_back(shared); }),
+        measure([&] { for (unsigned i = 0; i < consumers; ++i) plainCopies.push_back(plain); })
+    });
+    printRow("read copies", {
+        measure([&] { for (const auto &copy : sharedCopies) checksum[0] += copy.data()[size / 2]; }),
+        measure([&] { for (const auto &copy : plainCopies) checksum[1] += copy.data()[size / 2]; })
+    });
+    printRow("first write", {
+        measure([&] { *sharedCopies.front()[0] = 1; }),
+        measure([&] { *plainCopies.front()[0] = 1; })
+    });
+
+    std::cout << "Checksums match: " << (checksum[0] == checksum[1]) << std::endl;
+}
+
+
+/**
+ * Random range sums and minimums answered by RangeIndex and by scanning the DArray,
+ * followed by point updates through the index
+ * @param[in] size - amount of elements in the array
+ * @param[in] queries - amount of queries of each kind
+ */
+void benchmarkRangeIndex(unsigned size, unsigned queries = 10000) {
+    std::vector<int> values = randomValues(size);
+    DArray<long long> arr(size);
+    for (unsigned i = 0; i < size; ++i) *arr[int(i)] = values[i];
+    std::vector<std::pair<unsigned, unsigned>> ranges(queries);
+    std::mt19937 generator(7);
+    for (auto &[from, to] : ranges) {
+        from = generator() % size;
+        to = from + 1 + generator() % (size - from);
+    }
+    long long checksum[2] = {0, 0};
+
+    std::cout << std::left << std::setw(16) << "Operation" << std::right;
+    std::cout << std::setw(12) << "RangeIndex" << std::setw(12) << "scan" << std::endl;
+
+    const long long *data = arr.data();
+    std::unique_ptr<RangeIndex<long long>> index;
+    printRow("build", {measure([&] { index = std::make_unique<RangeIndex<long long>>(arr); })});
+    printRow("sum", {
+        measure([&] { for (auto [from, to] : ranges) checksum[0] += index->sum(from, to); }),
+        measure([&] { for (auto [from, to] : ranges) checksum[1] += std::accumulate(data + from, data + to, 0LL); })
+    });
+    printRow("min", {
+        measure([&] { for (auto [from, to] : ranges) checksum[0] += index->min(from, to); }),
+        measure([&] { for (auto [from, to] : ranges) checksum[1] += *std::min_element(data + from, data + to); })
+    });
+    printRow("set", {measure([&] { for (auto [from, to] : ranges) index->set(from, to); })});
+
+    std::cout << "Checksums match: " << (checksum[0] == checksum[1]) << std::endl;
+}
+
+
+/**
+ * Startup and scan of a file-backed array. MappedDArray maps the file without reading it,
+ * DArray has to read the whole file before the first access. The file is removed afterwards
+ * @param[in] size - amount of elements in the file
+ */
+void benchmarkMappedDArray(unsigned size) {
+#ifdef MAPPED_DARRAY_SUPPORTED
+    const std::string mapped = (std::filesystem::temp_directory_path() / "ads_mapped.bin").string();
+    const std::string plain = (std::filesystem::temp_directory_path() / "ads_plain.bin").string();
+    long long checksum[2] = {0, 0};
+
+    std::cout << std::left << std::setw(16) << "Operation" << std::right;
+    std::cout << std::setw(12) << "mapped" << std::setw(12) << "read" << std::endl;
+
+    printRow("write", {
+        measure([&] {
+            MappedDArray<int> arr(mapped);
+            arr.clear();
+            for (unsigned i = 0; i < size; ++i) arr.append(int(i));
+        }),
+        measure([&] {
+            std::ofstream file(plain, std::ios::binary);
+            for (unsigned i = 0; i < size; ++i) file.write(reinterpret_cast<const char*>(&i), sizeof(int));
+        })
+    });
+
+    MappedDArray<int> arr;
+    DArray<int> copy;
+    printRow("open", {
+        measure([&] { arr.open(mapped); }),
+        measure([&] {
+            std::ifstream file(plain, std::ios::binary);
+            copy.resize(size);
+            file.read(reinterpret_cast<char*>(copy.data()), std::streamsize(size) * sizeof(int));
+        })
+    });
+
+    arr.advise(MappedDArray<int>::Access::Sequential);
+    printRow("scan", {
+        measure([&] { for (int value : arr) checksum[0] += value; }),
+        measure([&] { for (int value : copy) checksum[1] += value; })
+    });
+
+    arr.close();
+    std::filesystem::remove(mapped);
+    std::filesystem::remove(plain);
+    std::cout << "Checksums match: " << (checksum[0] == checksum[1]) << std::endl;
+#else
+    (void)size;
+    std::cout << "Memory-mapped arrays aren't supported on this system\n";
+#endif
+}
+
+
+/**
+ * Throughput and stress check of ConcurrentList. For 1..cores producers every producer appends
+ * the own increasing sequence while the consumer keeps detaching the chains. Total amount of values
+ * and the order of each producer's values are checked after the run
+ * @param[in] perProducer - amount of values appended by each producer
+ */
+void benchmarkConcurrentList(unsigned perProducer) {
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+
+    std::cout << std::left << std::setw(16) << "Producers" << std::right;
+    std::cout << std::setw(12) << "Time, s" << std::setw(12) << "Mops/s" << std::setw(12) << "Detaches";
+    std::cout << std::setw(8) << "Valid" << std::endl;
+
+    for (unsigned producers = 1; producers <= cores; ++producers) {
+        ConcurrentList<int> queue;
+        List<int> result;
+        std::atomic<unsigned> finished = 0;
+        unsigned detaches = 0;
+
+        double seconds = measure([&] {
+            std::vector<std::thread> threads;
+            for (unsigned p = 0; p < producers; ++p) {
+                threads.emplace_back([&, p] {
+                    for (unsigned i = 0; i < perProducer; ++i)
+                        queue.append(int(p * perProducer + i));
+                    finished++;
+                });
+            }
+
+            // Consumer
+            while (finished.load() != producers) {
+                result.concat(queue.detach());
+                detaches++;
+            }
+            for (auto &thread : threads) thread.join();
+            result.concat(queue.detach());
+        });
+
+        // Every producer's values must come in the order of the appends
+        std::vector<unsigned> expected(producers, 0);
+        bool isValid = result.getSize() == producers * perProducer;
+        for (int value : result) {
+            unsigned p = unsigned(value) / perProducer;
+            isValid = isValid && expected[p] == unsigned(value) % perProducer;
+            expected[p]++;
+        }
+
+        std::cout << std::left << std::setw(16) << producers << std::right;
+        std::cout << std::scientific << std::setprecision(2) << std::setw(12) << seconds << std::defaultfloat;
+        std::cout << std::fixed << std::setprecision(1) << std::setw(12) << producers * perProducer / seconds / 1e6;
+        std::cout << std::defaultfloat << std::setw(12) << detaches << std::setw(8) << isValid << std::endl;
+    }
+}
+
+
+/// Operation of a concurrent stack history with the clock ticks of it's call and return
+struct StackEvent {
+    bool isPush;
+    bool isFound;   // Pop only: the stack wasn't empty
+    int value;
+    unsigned begin;
+    unsigned end;
+};
+
+
+/**
+ * Check that the history has a sequential order that respects real time and a sequential stack:
+ * an operation may go next if no unordered operation returned before it was called
+ * @param[in] events - operations of the history
+ * @param[in] done - bit mask of the operations already ordered
+ * @param[in, out] stack - contents of the sequential stack after the ordered operations
+ * @return true if the history is linearizable
+ */
+bool isLinearizable(const std::vector<StackEvent> &events, unsigned done, std::vector<int> &stack) {
+    if (done == (1u << events.size()) - 1) return true;
+
+    for (unsigned i = 0; i < events.size(); ++i) {
+        if (done & (1u << i)) continue;
+        bool isMinimal = true;
+        for (unsigned j = 0; j < events.size() && isMinimal; ++j)
+            isMinimal = (done & (1u << j)) || events[j].end > events[i].begin;
+        if (!isMinimal) continue;
+
+        const StackEvent &event = events[i];
+        if (event.isPush) {
+            stack.push_back(event.value);
+            if (isLinearizable(events, done | (1u << i), stack)) return true;
+            stack.pop_back();
+        } else if (!event.isFound) {
+            if (stack.empty() && isLinearizable(events, done | (1u << i), stack)) return true;
+        } else if (!stack.empty() && stack.back() == event.value) {
+            stack.pop_back();
+            if (isLinearizable(events, done | (1u << i), stack)) return true;
+            stack.push_back(event.value);
+        }
+    }
+    return false;
+}
+
+
+/**
+ * Throughput and stress check of ConcurrentStack. Every thread pushes and pops it's own values in pairs,
+ * the Treiber stack is compared with a Stack under a mutex; the sums of the pushed and popped values
+ * must match. Then short histories of 3 threads are recorded and checked for linearizability.
+ * Build with ADS_TSAN to run the check under ThreadSanitizer
+ * @param[in] perThread - amount of push/pop pairs of every thread
+ * @param[in] histories - amount of the recorded histories
+ */
+void benchmarkConcurrentStack(unsigned perThread, unsigned histories = 2000) {
+    unsigned cores = std::max(2u, std::thread::hardware_concurrency());
+
+    std::cout << std::left << std::setw(16) << "Threads" << std::right;
+    std::cout << std::setw(12) << "lock-free" << std::setw(12) << "mutex" << std::setw(8) << "Valid";
+    std::cout << "  (Mops/s)" << std::endl;
+
+    for (unsigned threads = 1; threads <= cores; threads *= 2) {
+        ConcurrentStack<long long> lockFree;
+        Stack<long long> locked;
+        std::mutex mutex;
+        std::atomic<long long> popped[2] = {0, 0};
+
+        auto run = [&](auto &&push, auto &&pop, std::atomic<long long> &sum) {
+            return measure([&] {
+                std::vector<std::thread> workers;
+                for (unsigned t = 0; t < threads; ++t) {
+                    workers.emplace_back([&, t] {
+                        long long local = 0;
+                        for (unsigned i = 0; i < perThread; ++i) {
+                            push((long long)t * perThread + i);
+                            local += pop();
+                        }
+                        sum += local;
+                    });
+                }
+                for (auto &worker : workers) worker.join();
+            });
+        };
+
+        double seconds[2] = {
+            run([&](long long value) { lockFree.push(value); },
+                [&] { long long value = 0; lockFree.pop(value); return value; }, popped[0]),
+            run([&](long long value) { std::lock_guard lock(mutex); locked.push(value); },
+                [&] { std::lock_guard lock(mutex); return locked.pop(); }, popped[1])
+        };
+
+        // Every thread pops after it's push, so the stacks end empty and every value is popped once
+        long long total = (long long)threads * perThread;
+        long long expected = total * (total - 1) / 2;
+        bool isValid = popped[0] == expected && popped[1] == expected && lockFree.isEmpty() && locked.isEmpty();
+
+        std::cout << std::left << std::setw(16) << threads << std::right << std::fixed << std::setprecision(1);
+        std::cout << std::setw(12) << 2 * total / seconds[0] / 1e6 << std::setw(12) << 2 * total / seconds[1] / 1e6;
+        std::cout << std::defaultfloat << std::setw(8) << isValid << std::endl;
+    }
+
+    // Linearizability: every thread makes random pushes of unique values and pops
+    constexpr unsigned threads = 3, operations = 4;
+    unsigned violations = 0;
+    for (unsigned h = 0; h < histories; ++h) {
+        ConcurrentStack<int> stack;
+        std::vector<StackEvent> events(threads * operations);
+        std::atomic<unsigned> clock = 0;
+        std::atomic<bool> isStarted = false;
+
+        std::vector<std::thread> workers;
+        for (unsigned t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                std::mt19937 generator(h * threads + t);
+                while (!isStarted.load()) std::this_thread::yield();
+                for (unsigned i = 0; i < operations; ++i) {
+                    StackEvent &event = events[t * operations + i];
+                    event.isPush = generator() % 2;
+                    event.value = int(t * operations + i);
+                    event.begin = clock++;
+                    if (event.isPush) stack.push(event.value);
+                    else event.isFound = stack.pop(event.value);
+                    event.end = clock++;
+                }
+            });
+        }
+        isStarted = true;
+        for (auto &worker : workers) worker.join();
+
+        std::vector<int> sequential;
+        violations += !isLinearizable(events, 0, sequential);
+    }
+    HazardPointers::collect();
+
+    std::cout << "Linearizable histories: " << histories - violations << " of " << histories << std::endl;
+}
+
+
+/// Generate an expression of about the given length: numbers, + - * /, spaces and nested braces
+std::string randomExpression(unsigned size, unsigned seed = 42) {
+    std::mt19937 generator(seed);
+    const char operators[] = {'+', '-', '*', '/'};
+    std::string expr;
+    expr.reserve(size + 16);
+    unsigned depth = 0;
+    while (expr.size() < size) {
+        if (generator() % 8 == 0) { expr += '('; depth++; }
+        expr += std::to_string(1 + generator() % 999);
+        if (depth > 0 && generator() % 8 == 0) { expr += ')'; depth--; }
+        expr += ' ';
+        expr += operators[generator() % 4];
+        expr += ' ';
+    }
+    expr += '1';
+    expr.append(depth, ')');
+    return expr;
+}
+
+
+/// Print one row of the RPN benchmark: elapsed time and the speed in MB of the expression per second
+void printThroughput(const std::string &name, double seconds, std::size_t bytes) {
+    std::cout << std::left << std::setw(16) << name << std::right << std::scientific << std::setprecision(2);
+    std::cout << std::setw(12) << seconds << std::fixed << std::setprecision(1) << std::setw(12) << bytes / seconds / 1e6;
+    std::cout << std::defaultfloat << std::endl;
+}
+
+
+/**
+ * Lexing, translation to RPN and evaluation of a long generated expression
+ * @param[in] size - length of the expression in bytes
+ */
+void benchmarkRPN(unsigned size) {
+    std::string expr = randomExpression(size);
+    std::vector<Token> rpn;
+    unsigned tokens = 0;
+
+    std::cout << std::left << std::setw(16) << "Operation" << std::right;
+    std::cout << std::setw(12) << "Time, s" << std::setw(12) << "MB/s" << std::endl;
+
+    printThroughput("lex", measure([&] {
+        Lexer lexer(expr);
+        while (lexer.next().kind != TokenKind::End) tokens++;
+    }), expr.size());
+    printThroughput("toRPN", measure([&] { rpn = toRPN(expr); }), expr.size());
+    double result = 0;
+    double seconds = measure([&] { result = evaluate(rpn); });
+    printThroughput("evaluate", seconds, expr.size());
+
+    std::cout << "Tokens: " << tokens << ", in RPN: " << rpn.size() << std::endl;
+    std::cout << "Evaluated: " << std::fixed << std::setprecision(1) << rpn.size() / seconds / 1e6 << " M tokens/s, result ";
+    std::cout << std::defaultfloat << std::setprecision(std::numeric_limits<double>::max_digits10) << result;
+    std::cout << std::setprecision(6) << std::endl;
+}
+
+
+#endif //PRACTICE01_BENCHMARK_H
@@ -5,7 +5,9 @@
 #include "structures/stack.h"
 #include <vector>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <charconv>
+#include <cctype>
 
 #include <iostream>
 #include <iomanip>
@@ -14,134 +16,185 @@
 #include <cmath>
 
 
+/// Operators of the expressions, the value is the index in the OPERATORS table
+enum class Operator : unsigned char { None, Add, Subtract, Multiply, Divide, Power, Sin, Cos };
+
+
+/// Properties of an operator
+struct OperatorInfo {
+    std::string_view name;
+    int precedence;
+    unsigned arity;      // Amount of operands
+};
+
+
+/// Operator table, indexed by Operator
+constexpr OperatorInfo OPERATORS[] = {
+        {"", 0, 0},
+        {"+", 1, 2}, {"-", 1, 2},
+        {"*", 2, 2}, {"/", 2, 2},
+        {"^", 3, 2},
+        {"sin", 4, 1}, {"cos", 4, 1}
+};
+
+
+/// Properties of the operator
+constexpr const OperatorInfo& info(Operator op) {
+    return OPERATORS[unsigned(op)];
+}
+
+
+/// Kinds of the tokens. End is returned by the lexer after the last token
+enum class TokenKind : unsigned char { Number, Operator, OpenBrace, CloseBrace, End };
+
+
 /**
- * Split expression string to vector of tokens. Operators: + - * / ^ ( ) sin cos 0-9. WS-friendly
- * @param[in] str - The expression
- * @return vector<string> tokens
+ * @struct Token
+ * @brief Token of an expression. The text is a view of the expression, which must outlive the token
  */
-std::vector<std::string> splitString(std::string str) {
-    // Empty expression handler
-    if (str.empty()) throw std::invalid_argument("Empty string");
+struct Token {
+    TokenKind kind = TokenKind::End;
+    Operator op = Operator::None;   // Operators only
+    double value = 0;               // Numbers only, parsed by the lexer
+    std::string_view text;          // Text of the token
+};
 
-    // Operators: + - * / ^ sin cos ( ) 0-9
-    std::vector<std::string> tokens;
-    char operators[7] = {'(', ')', '+', '-', '*', '/', '^'};
 
-    // Remove whitespaces
-    str.erase(std::remove(str.begin(), str.end(), ' '), str.end());
+/// Print the text of the token
+std::ostream& operator<< (std::ostream &os, const Token &token) {
+    return os << token.text;
+}
 
-    // Algorithm
-    std::string number;  // Any number will be stored here
-    for (size_t i = 0; i < str.size(); ++i) {
-        char c = str[i];
-        std::string s(1, c);  // Handle multiple char operators/operands (i.e. sin(), 123, etc.)
 
-        // Digit found
-        if (isdigit(c)) {
-            number += c;
-            continue;
-        }
+/**
+ * @class Lexer
+ * @brief Splits the expression into tokens one at a time. Operators: + - * / ^ ( ) sin cos, decimal numbers. WS-friendly
+ * Tokens are views of the expression and numbers are parsed in place, so lexing makes one pass over it
+ * and allocates nothing
+ */
+class Lexer {
+private:
+    std::string_view expr;
+    size_t position = 0;
+public:
+    explicit Lexer(std::string_view expr) : expr(expr) {}
+    Token next();
+};
 
-        // sin & cos operators
-        if ((c == 's' || c == 'c') && i+2 < str.size()) {
-            std::string substr = str.substr(i, 3);
-            if (substr == "sin" || substr == "cos") tokens.push_back(substr); // Handle sin or cos
-            else throw std::runtime_error("Unknown operator: " + substr);     // Handle wrong operator
-            if (!number.empty()) {
-                tokens.push_back(number);
-                number.clear();
-            }
-            i += 2;
-            continue;
-        }
 
-        // Single-char operators (look for char operators[8])
-        if (std::find(std::begin(operators), std::end(operators), c) != std::end(operators)) {
-            if (!number.empty()) {
-                tokens.push_back(number);
-                number.clear();
-            }
-            tokens.push_back(s);
-            continue;
-        }
+/// Read the next token. Throws std::runtime_error on an unknown symbol or a malformed number
+Token Lexer::next() {
+    while (position < expr.size() && isspace((unsigned char)expr[position])) position++;
+    if (position == expr.size()) return {};
 
-        // Unknown symbol error
-        throw std::runtime_error("Unknown symbol: " + s);
+    size_t start = position;
+    char c = expr[position++];
+
+    // Number: digits with an optional fraction and exponent, e.g. 12, 0.5, .5, 1e-3
+    if (isdigit((unsigned char)c) || c == '.') {
+        Token token{TokenKind::Number, Operator::None, 0, {}};
+        auto [end, error] = std::from_chars(expr.data() + start, expr.data() + expr.size(), token.value);
+        if (error == std::errc::result_out_of_range) throw std::runtime_error("Number out of range");
+        if (error != std::errc()) throw std::runtime_error("Invalid number: " + std::string(1, c));
+        position = size_t(end - expr.data());
+        token.text = expr.substr(start, position - start);
+        return token;
+    }
+
+    // Single-char operators and braces
+    switch (c) {
+        case '(': return {TokenKind::OpenBrace, Operator::None, 0, expr.substr(start, 1)};
+        case ')': return {TokenKind::CloseBrace, Operator::None, 0, expr.substr(start, 1)};
+        case '+': return {TokenKind::Operator, Operator::Add, 0, expr.substr(start, 1)};
+        case '-': return {TokenKind::Operator, Operator::Subtract, 0, expr.substr(start, 1)};
+        case '*': return {TokenKind::Operator, Operator::Multiply, 0, expr.substr(start, 1)};
+        case '/': return {TokenKind::Operator, Operator::Divide, 0, expr.substr(start, 1)};
+        case '^': return {TokenKind::Operator, Operator::Power, 0, expr.substr(start, 1)};
+        default: break;
+    }
+
+    // sin & cos operators
+    std::string_view name = expr.substr(start, 3);
+    if (name == info(Operator::Sin).name || name == info(Operator::Cos).name) {
+        position = start + 3;
+        return {TokenKind::Operator, name[0] == 's' ? Operator::Sin : Operator::Cos, 0, name};
     }
-    if (!number.empty()) tokens.push_back(number);
-    return tokens;
+    if (c == 's' || c == 'c') throw std::runtime_error("Unknown operator: " + std::string(name));
+
+    // Unknown symbol error
+    throw std::runtime_error("Unknown symbol: " + std::string(1, c));
 }
 
 
 /// toRPN() tool. Print the intermediate result and stack state
-void printDebug(const std::vector<std::string> &result, const Stack &opStack, const std::vector<std::string> &tokens) {
-    int size = 7;
-    for (auto &op : tokens) if (op != "(" && op != ")") size += int(op.length()) + 1;
+void printDebug(const std::vector<Token> &result, const Stack<Token> &opStack, int width) {
     std::cout << "Result: ";
-    for (const std::string &token : result) {
+    for (const Token &token : result) {
         std::cout << token << ' ';
-        size -= int(token.length()) + 1;
+        width -= int(token.text.length()) + 1;
     }
-    std::cout << std::setw(size) << "Stack: " << opStack << std::endl;
+    std::cout << std::setw(width) << "Stack: " << opStack << std::endl;
 }
 
 
 /**
  * Translates infix-form expression to the reverse polish-form
- * @param[in] expr - infix-form expression
+ * @param[in] expr - infix-form expression, the tokens refer to it
  * @param[in] isDebugMode - print details of each operation if true
- * @return vector<string> tokens
+ * @return tokens in RPN
  */
-std::vector<std::string> toRPN(const std::string& expr, bool isDebugMode = false) {
-    std::vector<std::string> result;
-
-    // Auxiliary vars
-    Stack opStack;                                          // Store unused expressions
-    std::vector<std::string> tokens = splitString(expr);    // [expr] reform to the token-form
-    std::unordered_map<std::string, int> precedences {      // Operands priority map
-            {"+", 1}, {"-", 1},
-            {"*", 2}, {"/", 2},
-            {"^", 3},
-            {"sin", 4}, {"cos", 4}
-    };
-
-    if (isDebugMode) std::cout << "Translating to RPN...\n";
-
-    for (std::string token : tokens) {
-
-        // Number: Add to result
-        if (isdigit(token[0])) {
-            result.push_back(token);
-        }
-        // Open brace: Add to stack
-        else if (token == "(") {
-            opStack.push(token);
-        }
-        // Close brace: Read stack while ( not found
-        else if (token == ")") {
-            while (*opStack.top() != "(") result.push_back(opStack.pop());
-            if (opStack.isEmpty()) throw std::runtime_error("Unclosed brace");  // Error handler
-            opStack.pop(); // Delete open brace
-        }
-        // Operators (look for map<string, int> precedences)
-        else if (precedences.count(token) > 0) {
-            while (!opStack.isEmpty() && *opStack.top() != "(" && precedences[token] <= precedences[*opStack.top()])
-                result.push_back(opStack.pop());
-            opStack.push(token);
-        }
-        // Invalid syntax
-        else {
-            throw std::runtime_error("Invalid syntax: " + token);
+std::vector<Token> toRPN(std::string_view expr, bool isDebugMode = false) {
+    // Empty expression handler
+    if (expr.empty()) throw std::invalid_argument("Empty string");
+
+    std::vector<Token> result;
+    Stack<Token> opStack;  // Store unused operators and open braces
+
+    // Debug output is aligned to the length of the whole RPN
+    int width = 7;
+    if (isDebugMode) {
+        Lexer lexer(expr);
+        for (Token token = lexer.next(); token.kind != TokenKind::End; token = lexer.next())
+            if (token.kind == TokenKind::Number || token.kind == TokenKind::Operator) width += int(token.text.length()) + 1;
+        std::cout << "Translating to RPN...\n";
+    }
+
+    Lexer lexer(expr);
+    for (Token token = lexer.next(); token.kind != TokenKind::End; token = lexer.next()) {
+        switch (token.kind) {
+            // Number: Add to result
+            case TokenKind::Number:
+                result.push_back(token);
+                break;
+
+            // Open brace: Add to stack
+            case TokenKind::OpenBrace:
+                opStack.push(token);
+                break;
+
+            // Close brace: Read stack while ( not found
+            case TokenKind::CloseBrace:
+                while (!opStack.isEmpty() && opStack.top()->kind != TokenKind::OpenBrace) result.push_back(opStack.pop());
+                if (opStack.isEmpty()) throw std::runtime_error("Unclosed brace");  // Error handler
+                opStack.pop(); // Delete open brace
+                break;
+
+            // Operators (look for the OPERATORS table)
+            default:
+                while (!opStack.isEmpty() && opStack.top()->kind != TokenKind::OpenBrace &&
+                       info(token.op).precedence <= info(opStack.top()->op).precedence)
+                    result.push_back(opStack.pop());
+                opStack.push(token);
         }
 
-        if (isDebugMode) printDebug(result, opStack, tokens);
+        if (isDebugMode) printDebug(result, opStack, width);
     }
 
     // Push back remaining operators
     while (!opStack.isEmpty()) {
-        if (*opStack.top() == "(") throw std::runtime_error("Unclosed brace");
+        if (opStack.top()->kind == TokenKind::OpenBrace) throw std::runtime_error("Unclosed brace");
         result.push_back(opStack.pop());
-        if (isDebugMode) printDebug(result, opStack, tokens);
+        if (isDebugMode) printDebug(result, opStack, width);
     }
 
     return result;
@@ -155,58 +208,57 @@ std::vector<std::string> toRPN(const std::string& expr, bool isDebugMode = false
  * @param[in] b - 2nd operand (may be anything if calculating sin/cos. careful)
  * @return math result
  */
-double calculate(std::string op, double a, double b) {
-    switch (op[0]) {
-        case '+': return a + b;
-        case '-': return a - b;
-        case '*': return a * b;
-        case '/': {
+double calculate(Operator op, double a, double b) {
+    switch (op) {
+        case Operator::Add: return a + b;
+        case Operator::Subtract: return a - b;
+        case Operator::Multiply: return a * b;
+        case Operator::Divide: {
             if (b == 0)
                 throw std::runtime_error("Division by zero: " + std::to_string(a) + " / " + std::to_string(b));
             return a / b;
         }
-        case '^': return pow(a, b);
-        case 's': return sin(a);
-        case 'c': return cos(a);
-        default: throw std::invalid_argument("Wrong operator: " + op);
+        case Operator::Power: return pow(a, b);
+        case Operator::Sin: return sin(a);
+        case Operator::Cos: return cos(a);
+        default: throw std::invalid_argument("Wrong operator: " + std::string(info(op).name));
     }
 }
 
 
 /**
  * Get tokens of expression and return [double] result
- * @param[in] expr - vector<string> tokens
+ * @param[in] expr - tokens in RPN
  * @param[in] isDebugMode - print each operation details if true
  * @return math result
  */
-double evaluate(const std::vector<std::string>& expr, bool isDebugMode = false) {
-    Stack opStack;
-    for (std::string token : expr) {
-        if (isdigit(token[0])) {
-            opStack.push(token);
+double evaluate(const std::vector<Token>& expr, bool isDebugMode = false) {
+    Stack<double> opStack;
+    opStack.reserve(unsigned(expr.size()));
+    for (const Token &token : expr) {
+        if (token.kind == TokenKind::Number) {
+            opStack.push(token.value);
             if (isDebugMode)
                 std::cout << "Number found. \tStack: " << opStack << std::endl;
         } else {
-            if (token != "sin" && token != "cos" && opStack.getSize() < 2)
+            unsigned arity = info(token.op).arity;
+            if (opStack.getSize() < arity)
                 throw std::runtime_error("Nothing to calculate");
 
-            // Calculate. If statement exist because of sin & cos take one arg
-            std::string calc;
-            double op2 = std::stod(opStack.pop());
-            double op1;
-            if (token == "sin" || token == "cos") {
-                calc = std::to_string(calculate(token, op2, 0));
-            } else {
-                op1 = std::stod(opStack.pop());
-                calc = std::to_string(calculate(token, op1, op2));
-            }
+            // Calculate. Arity check exists because sin & cos take one arg
+            double op2 = opStack.pop();
+            double op1 = arity == 2 ? opStack.pop() : 0;
+            double calc = arity == 2 ? calculate(token.op, op1, op2) : calculate(token.op, op2, 0);
 
             opStack.push(calc);
             if (isDebugMode)
                 std::cout << "Evaluate " << op1 << token << op2 << ". \tStack: " << opStack << std::endl;
         }
     }
-    return std::stod(opStack.pop());
+    if (opStack.isEmpty()) throw std::runtime_error("Nothing to calculate");
+    if (opStack.getSize() != 1)
+        throw std::runtime_error("Missing operator: " + std::to_string(opStack.getSize()) + " operands left");
+    return opStack.pop();
 }
 
 #endif //PRACTICE01_RPN_H
\ No newline at end of file
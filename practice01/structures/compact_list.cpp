@@ -0,0 +1,294 @@
+#include "compact_list.h"
+
+#include <iostream>
+#include <utility>
+
+
+/// Default constructor. Size = 0, no slots are allocated
+CompactList::CompactList() = default;
+
+
+/**
+ * Create compact list filled with given numbers. Slots go in the traversal order
+ * @param[in] size - amount of values
+ * @param[in] values - int values of list
+ */
+CompactList::CompactList(unsigned size, const int *values) {
+    _values.reserve(size);
+    _next.reserve(size);
+    _prev.reserve(size);
+    for (unsigned i = 0; i < size; ++i)
+        append(values[i]);
+}
+
+
+/// Print the list
+std::ostream& operator<< (std::ostream &os, const CompactList &list) {
+    for (int value : list)
+        os << value << ' ';
+    return os;
+}
+
+
+/// Get value by it's index via [] operator
+int * CompactList::operator[] (int index) {
+    return get(index);
+}
+
+
+/// Iterator to the first element
+CompactList::iterator CompactList::begin() {
+    return {_head, this};
+}
+
+
+/// Iterator past the last element
+CompactList::iterator CompactList::end() {
+    return {NIL, this};
+}
+
+
+/// Const iterator to the first element
+CompactList::const_iterator CompactList::begin() const {
+    return {_head, this};
+}
+
+
+/// Const iterator past the last element
+CompactList::const_iterator CompactList::end() const {
+    return {NIL, this};
+}
+
+
+/// Reverse iterator to the last element
+CompactList::reverse_iterator CompactList::rbegin() {
+    return reverse_iterator(end());
+}
+
+
+/// Reverse iterator before the first element
+CompactList::reverse_iterator CompactList::rend() {
+    return reverse_iterator(begin());
+}
+
+
+/// Const reverse iterator to the last element
+CompactList::const_reverse_iterator CompactList::rbegin() const {
+    return const_reverse_iterator(end());
+}
+
+
+/// Const reverse iterator before the first element
+CompactList::const_reverse_iterator CompactList::rend() const {
+    return const_reverse_iterator(begin());
+}
+
+
+/// Take a slot from the free list or add a new one at the end of the arrays. Slot is not linked
+uint32_t CompactList::createSlot(int value) {
+    if (_free != NIL) {
+        uint32_t slot = _free;
+        _free = _next[slot];
+        _values[slot] = value;
+        return slot;
+    }
+
+    _values.push_back(value);
+    _next.push_back(NIL);
+    _prev.push_back(NIL);
+    return uint32_t(_values.size() - 1);
+}
+
+
+/// Return the unlinked slot to the free list. Both links point to the next free slot, so reverse() keeps the chain
+void CompactList::destroySlot(uint32_t slot) {
+    _next[slot] = _free;
+    _prev[slot] = _free;
+    _free = slot;
+}
+
+
+/// Find the slot of the index-th node walking from the closest end (index < size)
+uint32_t CompactList::locate(unsigned index) const {
+    uint32_t slot;
+    if (index < _size / 2) {
+        slot = _head;
+        for (unsigned i = 0; i < index; ++i) slot = _next[slot];
+    } else {
+        slot = _tail;
+        for (unsigned i = _size - 1; i > index; --i) slot = _prev[slot];
+    }
+    return slot;
+}
+
+
+/// Unlink the slot from the list. Slot is not freed, size is not updated
+void CompactList::unlinkSlot(uint32_t slot) {
+    _prev[slot] != NIL ? _next[_prev[slot]] = _next[slot] : _head = _next[slot];
+    _next[slot] != NIL ? _prev[_next[slot]] = _prev[slot] : _tail = _prev[slot];
+}
+
+
+/// Clear the list. Memory of the arrays is freed
+void CompactList::clear() {
+    _values = {};
+    _next = {};
+    _prev = {};
+    _head = NIL;
+    _tail = NIL;
+    _free = NIL;
+    _size = 0;
+}
+
+
+/// Reverse the list in O(1). Arrays of links are exchanged
+void CompactList::reverse() {
+    _next.swap(_prev);
+    std::swap(_head, _tail);
+}
+
+
+/**
+ * Renumber the nodes into the traversal order and drop the free slots.
+ * After that the list is walked by sequential memory reads. Invalidates all the iterators
+ */
+void CompactList::compact() {
+    std::vector<int> values;
+    values.reserve(_size);
+    for (uint32_t slot = _head; slot != NIL; slot = _next[slot])
+        values.push_back(_values[slot]);
+    _values.swap(values);
+
+    // i-th node is linked with it's neighbours
+    _next.resize(_size);
+    _prev.resize(_size);
+    _next.shrink_to_fit();
+    _prev.shrink_to_fit();
+    for (uint32_t i = 0; i < _size; ++i) {
+        _next[i] = i + 1;
+        _prev[i] = i - 1;
+    }
+    if (_size) {
+        _next[_size - 1] = NIL;
+        _prev[0] = NIL;
+    }
+
+    _head = _size ? 0 : NIL;
+    _tail = _size ? _size - 1 : NIL;
+    _free = NIL;
+}
+
+
+/// Get value by it's index
+int * CompactList::get(int index) {
+    if (isEmpty()) {
+        std::cout << "IndexError: The list is empty\n";
+        return nullptr;
+    } else if (index >= int(getSize()) || index < -int(getSize())) {
+        std::cout << "IndexError: Index out of range\n";
+        return nullptr;
+    } else if (index < 0) {
+        index = int(getSize()) + index;
+    }
+
+    return &_values[locate(unsigned(index))];
+}
+
+
+/// Return index if element found else -1
+int CompactList::find(int value) const {
+    int i = 0;
+    for (uint32_t slot = _head; slot != NIL; slot = _next[slot], ++i)
+        if (_values[slot] == value) return i;
+    return -1;
+}
+
+
+/// Add element to the end of the list
+void CompactList::append(int value) {
+    insert(end(), value);
+}
+
+
+/// Add element to the specified position
+void CompactList::insert(unsigned index, int value) {
+    if (index >= _size) {
+        std::cout << "IndexError: Index out of range\n";
+        return;
+    }
+
+    insert(iterator(locate(index), this), value);
+}
+
+
+/// Remove element by it's index
+void CompactList::remove(unsigned index) {
+    if (index >= _size) {
+        std::cout << "IndexError: Index out of range\n";
+        return;
+    }
+
+    erase(iterator(locate(index), this));
+}
+
+
+/// Swap two values by their indexes
+void CompactList::swap(unsigned i1, unsigned i2) {
+    if (i1 == i2) return;
+
+    int *value1 = get(int(i1));
+    int *value2 = get(int(i2));
+    if (!value1 || !value2) return;
+
+    std::swap(*value1, *value2);
+}
+
+
+/// Insert element before the cursor in O(1). Return cursor to the inserted node
+CompactList::iterator CompactList::insert(iterator pos, int value) {
+    uint32_t slot = createSlot(value);
+    uint32_t prev = pos._slot != NIL ? _prev[pos._slot] : _tail;
+
+    _prev[slot] = prev;
+    _next[slot] = pos._slot;
+    prev != NIL ? _next[prev] = slot : _head = slot;
+    pos._slot != NIL ? _prev[pos._slot] = slot : _tail = slot;
+    _size++;
+
+    return {slot, this};
+}
+
+
+/**
+ * Remove the node under the cursor in O(1). The slot is reused by the next insertion
+ * @param[in] pos - cursor to an existing node
+ * @return cursor to the node following the removed one
+ */
+CompactList::iterator CompactList::erase(iterator pos) {
+    if (pos._slot == NIL) return end();
+
+    uint32_t next = _next[pos._slot];
+    unlinkSlot(pos._slot);
+    destroySlot(pos._slot);
+    _size--;
+
+    return {next, this};
+}
+
+
+/// Return size of the list
+unsigned CompactList::getSize() const {
+    return _size;
+}
+
+
+/// Return amount of allocated slots (nodes and free slots)
+unsigned CompactList::getCapacity() const {
+    return _values.size();
+}
+
+
+/// Return false if list is empty else true
+bool CompactList::isEmpty() const {
+    return _size == 0;
+}
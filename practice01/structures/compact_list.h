@@ -0,0 +1,118 @@
+#ifndef PRACTICE01_COMPACT_LIST_H
+#define PRACTICE01_COMPACT_LIST_H
+
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+
+/**
+ * @class CompactList
+ * @brief Doubly-linked list stored as structure of arrays
+ * Values, 'next' and 'prev' links live in three contiguous arrays and nodes are linked by 32-bit indexes,
+ * so a node takes 12 bytes instead of 24 (plus the allocator overhead) of List. Removed slots are kept
+ * in a free list and reused. compact() renumbers the nodes into the traversal order, after that
+ * a scan reads the arrays sequentially. Has the same interface as List
+ */
+class CompactList {
+public:
+    static constexpr uint32_t NIL = UINT32_MAX;
+
+    /**
+     * @class Iterator
+     * @brief Bidirectional iterator over the list values. It's also a cursor to the underlying slot
+     * end() is represented by NIL slot, decrementing it gives the tail
+     */
+    template <bool isConst>
+    class Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<isConst, const int*, int*>;
+        using reference = std::conditional_t<isConst, const int&, int&>;
+        using ListPtr = std::conditional_t<isConst, const CompactList*, CompactList*>;
+
+        Iterator() = default;
+        template <bool isOtherConst> requires (isConst && !isOtherConst)
+        Iterator(const Iterator<isOtherConst> &other) : _slot(other._slot), _list(other._list) {}
+
+        reference operator* () const { return _list->_values[_slot]; }
+        pointer operator-> () const { return &_list->_values[_slot]; }
+        Iterator& operator++ () { _slot = _list->_next[_slot]; return *this; }
+        Iterator& operator-- () { _slot = _slot != NIL ? _list->_prev[_slot] : _list->_tail; return *this; }
+        Iterator operator++ (int) { Iterator temp = *this; ++*this; return temp; }
+        Iterator operator-- (int) { Iterator temp = *this; --*this; return temp; }
+        bool operator== (const Iterator &rhs) const { return _slot == rhs._slot; }
+
+        /// Slot under the cursor (NIL for end)
+        [[nodiscard]] uint32_t slot() const { return _slot; }
+
+    private:
+        uint32_t _slot = NIL;
+        ListPtr _list = nullptr;
+
+        Iterator(uint32_t slot, ListPtr list) : _slot(slot), _list(list) {}
+        friend class CompactList;
+        friend class Iterator<!isConst>;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+    std::vector<int> _values;
+    std::vector<uint32_t> _next;
+    std::vector<uint32_t> _prev;
+    uint32_t _head = NIL;
+    uint32_t _tail = NIL;
+    uint32_t _free = NIL;  // First free slot. Free slots are chained by both 'next' and 'prev'
+    unsigned _size = 0;
+
+    uint32_t createSlot(int);
+    void destroySlot(uint32_t);
+    uint32_t locate(unsigned) const;
+    void unlinkSlot(uint32_t);
+public:
+    // Constructors and destructor
+    CompactList();
+    explicit CompactList(unsigned, const int*);
+
+    // Operators
+    friend std::ostream& operator<< (std::ostream&, const CompactList&);
+    int * operator[] (int);
+
+    // Iterators
+    iterator begin();
+    iterator end();
+    [[nodiscard]] const_iterator begin() const;
+    [[nodiscard]] const_iterator end() const;
+    reverse_iterator rbegin();
+    reverse_iterator rend();
+    [[nodiscard]] const_reverse_iterator rbegin() const;
+    [[nodiscard]] const_reverse_iterator rend() const;
+
+    // Methods
+    void clear();
+    void reverse();
+    void compact();
+    int * get(int);
+    [[nodiscard]] int find(int) const;
+    void append(int);
+    void insert(unsigned, int);
+    void remove(unsigned);
+    void swap(unsigned, unsigned);
+    iterator insert(iterator, int);
+    iterator erase(iterator);
+    [[nodiscard]] unsigned getSize() const;
+    [[nodiscard]] unsigned getCapacity() const;
+    [[nodiscard]] bool isEmpty() const;
+};
+
+
+#endif //PRACTICE01_COMPACT_LIST_H
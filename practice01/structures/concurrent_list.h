@@ -0,0 +1,182 @@
+#ifndef PRACTICE01_CONCURRENT_LIST_H
+#define PRACTICE01_CONCURRENT_LIST_H
+
+#include "dl_list.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+
+
+/**
+ * @class ConcurrentList
+ * @brief Lock-free multi-producer append queue on the List nodes
+ * Any amount of threads append concurrently, one consumer thread detaches the accumulated chain
+ * into a regular List in O(1). Producers link the nodes by exchanging the tail, so an append is one
+ * atomic exchange and never waits for other producers. Appends of one producer keep their order.
+ *
+ * Nodes are collected into one of two generations. detach() switches the producers to the other
+ * generation and waits until the appends already started in the old one are linked.
+ * Nodes are taken from the allocator, which must be thread-safe (std::allocator is)
+ * @tparam T - type of the values
+ * @tparam Allocator - allocator the nodes are taken from (rebound to Node<T>)
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class ConcurrentList {
+private:
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node<T>>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    /// Chain of nodes appended while the generation is current. Own cache line to avoid false sharing
+    struct alignas(64) Generation {
+        std::atomic<Node<T>*> head = nullptr;
+        std::atomic<Node<T>*> tail = nullptr;
+        std::atomic<unsigned> count = 0;
+        std::atomic<unsigned> writers = 0;  // Producers that entered the generation and haven't finished linking
+    };
+
+    Generation _generations[2];
+    alignas(64) std::atomic<unsigned long long> _current = 0;  // Number of the current generation
+    [[no_unique_address]] NodeAllocator _alloc;
+
+    void link(Node<T>*);
+public:
+    // Constructors and destructor
+    ConcurrentList();
+    explicit ConcurrentList(const Allocator&);
+    ConcurrentList(const ConcurrentList&) = delete;
+    ~ConcurrentList();
+
+    // Operators
+    ConcurrentList& operator= (const ConcurrentList&) = delete;
+
+    // Methods
+    void append(const T&);
+    void append(T&&);
+    template <typename... Args>
+    void emplace_back(Args&&...);
+    List<T, Allocator> detach();
+    [[nodiscard]] unsigned getSize() const;
+    [[nodiscard]] bool isEmpty() const;
+};
+
+
+/// Default constructor. Both generations are empty
+template <typename T, typename Allocator>
+ConcurrentList<T, Allocator>::ConcurrentList() = default;
+
+
+/// Create empty list that takes nodes from the given allocator
+template <typename T, typename Allocator>
+ConcurrentList<T, Allocator>::ConcurrentList(const Allocator &alloc) : _alloc(alloc) {}
+
+
+/// Free the nodes that weren't detached. No producer may run
+template <typename T, typename Allocator>
+ConcurrentList<T, Allocator>::~ConcurrentList() {
+    detach();
+}
+
+
+/**
+ * Link the constructed node after the tail of the current generation. Thread-safe
+ * @param[in] node - node with next == nullptr
+ */
+template <typename T, typename Allocator>
+void ConcurrentList<T, Allocator>::link(Node<T> *node) {
+    while (true) {
+        unsigned long long current = _current.load();
+        Generation &generation = _generations[current & 1];
+
+        // Register in the generation and make sure the consumer hasn't switched it meanwhile.
+        // Otherwise the consumer could take the chain before this node is linked
+        generation.writers.fetch_add(1);
+        if (_current.load() != current) {
+            generation.writers.fetch_sub(1, std::memory_order_release);
+            continue;
+        }
+
+        // Exchange orders the writes: 'next' of the previous tail is only written by the producer that replaced it
+        Node<T> *prev = generation.tail.exchange(node, std::memory_order_acq_rel);
+        node->prev = prev;
+        if (prev) prev->next = node;
+        else generation.head.store(node, std::memory_order_relaxed);
+        generation.count.fetch_add(1, std::memory_order_relaxed);
+
+        generation.writers.fetch_sub(1, std::memory_order_release);
+        return;
+    }
+}
+
+
+/// Add copy of the element to the end of the list. Thread-safe
+template <typename T, typename Allocator>
+void ConcurrentList<T, Allocator>::append(const T &value) {
+    emplace_back(value);
+}
+
+
+/// Move the element to the end of the list. Thread-safe
+template <typename T, typename Allocator>
+void ConcurrentList<T, Allocator>::append(T &&value) {
+    emplace_back(std::move(value));
+}
+
+
+/**
+ * Construct the element in place at the end of the list. Thread-safe
+ * @param[in] args - arguments forwarded to the constructor of T
+ */
+template <typename T, typename Allocator>
+template <typename... Args>
+void ConcurrentList<T, Allocator>::emplace_back(Args&&... args) {
+    Node<T> *node = NodeTraits::allocate(_alloc, 1);
+    NodeTraits::construct(_alloc, node, std::forward<Args>(args)...);
+    link(node);
+}
+
+
+/**
+ * Take all the appended nodes as a regular list in O(1) (plus the wait for the appends in progress).
+ * Must be called by one consumer thread at a time
+ * @return list of the appended values in the order of the appends
+ */
+template <typename T, typename Allocator>
+List<T, Allocator> ConcurrentList<T, Allocator>::detach() {
+    // Switch the producers to the other generation, it was emptied by the previous detach
+    unsigned long long current = _current.load();
+    Generation &generation = _generations[current & 1];
+    _current.store(current + 1);
+
+    // Wait for the producers that entered the old generation. The load is seq_cst like the producer's
+    // fetch_add and the store above: either the consumer sees the writer or the writer sees the switch
+    while (generation.writers.load() != 0)
+        std::this_thread::yield();
+
+    List<T, Allocator> list(static_cast<Allocator>(_alloc));
+    Node<T> *head = generation.head.load(std::memory_order_relaxed);
+    if (head) list.adopt(head, generation.tail.load(std::memory_order_relaxed), generation.count.load(std::memory_order_relaxed));
+
+    generation.head.store(nullptr, std::memory_order_relaxed);
+    generation.tail.store(nullptr, std::memory_order_relaxed);
+    generation.count.store(0, std::memory_order_relaxed);
+
+    return list;
+}
+
+
+/// Return amount of the appended values that weren't detached yet. It's a snapshot, producers may change it
+template <typename T, typename Allocator>
+unsigned ConcurrentList<T, Allocator>::getSize() const {
+    return _generations[_current.load() & 1].count.load(std::memory_order_relaxed);
+}
+
+
+/// Return true if there are no values to detach (snapshot)
+template <typename T, typename Allocator>
+bool ConcurrentList<T, Allocator>::isEmpty() const {
+    return getSize() == 0;
+}
+
+
+#endif //PRACTICE01_CONCURRENT_LIST_H
@@ -0,0 +1,122 @@
+#ifndef PRACTICE01_CONCURRENT_STACK_H
+#define PRACTICE01_CONCURRENT_STACK_H
+
+#include "hazard_pointers.h"
+#include <atomic>
+#include <utility>
+
+
+/**
+ * @class ConcurrentStack
+ * @brief Lock-free LIFO stack (Treiber stack) for any amount of threads
+ * The stack is a singly linked list, push and pop swap the top with one compare-and-swap and retry
+ * if another thread changed it first, so some thread always makes progress.
+ * pop() protects the top with a hazard pointer before reading it's next node. The popped node is
+ * retired, not deleted, so it can't be freed or reused while a concurrent pop still holds it:
+ * no thread reads freed memory and a stale top can't match a new node at the same address (ABA)
+ * @tparam T - type of the values
+ */
+template <typename T>
+class ConcurrentStack {
+private:
+    struct Node {
+        T value;
+        Node *next = nullptr;
+
+        template <typename... Args>
+        explicit Node(Args&&... args) : value(std::forward<Args>(args)...) {}
+    };
+
+    alignas(64) std::atomic<Node*> _top = nullptr;
+public:
+    // Constructors and destructor
+    ConcurrentStack();
+    ConcurrentStack(const ConcurrentStack&) = delete;
+    ~ConcurrentStack();
+
+    // Operators
+    ConcurrentStack& operator= (const ConcurrentStack&) = delete;
+
+    // Methods
+    void push(const T&);
+    void push(T&&);
+    template <typename... Args>
+    void emplace(Args&&...);
+    bool pop(T&);
+    [[nodiscard]] bool isEmpty() const;
+};
+
+
+/// Default constructor. Creates empty stack
+template <typename T>
+ConcurrentStack<T>::ConcurrentStack() = default;
+
+
+/// Free the nodes left in the stack. No thread may use it
+template <typename T>
+ConcurrentStack<T>::~ConcurrentStack() {
+    Node *node = _top.load(std::memory_order_acquire);
+    while (node) delete std::exchange(node, node->next);
+}
+
+
+/// Add copy of the element to the top of the stack. Thread-safe
+template <typename T>
+void ConcurrentStack<T>::push(const T &value) {
+    emplace(value);
+}
+
+
+/// Move the element to the top of the stack. Thread-safe
+template <typename T>
+void ConcurrentStack<T>::push(T &&value) {
+    emplace(std::move(value));
+}
+
+
+/**
+ * Construct the element on the top of the stack. Thread-safe
+ * @param[in] args - arguments forwarded to the constructor of T
+ */
+template <typename T>
+template <typename... Args>
+void ConcurrentStack<T>::emplace(Args&&... args) {
+    auto *node = new Node(std::forward<Args>(args)...);
+    node->next = _top.load(std::memory_order_relaxed);
+    while (!_top.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed));
+}
+
+
+/**
+ * Move the top element out of the stack. Thread-safe
+ * @param[out] value - the popped element
+ * @return false if the stack was empty, the value is left as it was
+ */
+template <typename T>
+bool ConcurrentStack<T>::pop(T &value) {
+    HazardPointers::Guard guard;
+    Node *node;
+
+    // The unlink is seq_cst like the hazard slots: a scan that starts after it sees every slot
+    // that protected the node, or the protecting thread sees the new top and lets the node go
+    do {
+        node = guard.protect(_top);
+        if (!node) return false;
+    } while (!_top.compare_exchange_weak(node, node->next, std::memory_order_seq_cst, std::memory_order_relaxed));
+
+    // The node is unlinked, only this thread may touch the value
+    value = std::move(node->value);
+    guard.reset();
+    HazardPointers::retire(node);
+    return true;
+}
+
+
+/// Return true if the stack has no elements (snapshot)
+template <typename T>
+bool ConcurrentStack<T>::isEmpty() const {
+    return _top.load(std::memory_order_relaxed) == nullptr;
+}
+
+
+#endif //PRACTICE01_CONCURRENT_STACK_H
@@ -1,48 +1,1043 @@
 #ifndef PRACTICE01_DL_LIST_H
 #define PRACTICE01_DL_LIST_H
 
+#include "node_pool.h"
+#include "list_index.h"
+#include "stats.h"
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+#include <ranges>
+#include <span>
 
 /// Node structure represents a node in a Doubly-Linked List
+template <typename T>
 struct Node {
-    int value = 0;
-    struct Node *next = nullptr;
-    struct Node *prev = nullptr;
+    T value;
+    Node *next = nullptr;
+    Node *prev = nullptr;
+
+    /// Construct the value in place from the given arguments
+    template <typename... Args>
+    explicit Node(Args&&... args) : value(std::forward<Args>(args)...) {}
 };
 
 
+template <typename T, typename Allocator>
+class ConcurrentList;
+
+
+/**
+ * @class List
+ * @brief Doubly-Linked List of values of any type
+ * Nodes are taken from the allocator one by one or from the own pool (see setPooled()).
+ * Optional positional index makes the access by index logarithmic (see setIndexed())
+ * @tparam T - type of the values
+ * @tparam Allocator - allocator the nodes are taken from (rebound to Node<T>)
+ */
+template <typename T, typename Allocator = std::allocator<T>>
 class List {
+public:
+    /**
+     * @class Iterator
+     * @brief Bidirectional iterator over the list values. It's also a cursor to the underlying node
+     * end() is represented by nullptr node, decrementing it gives the tail
+     */
+    template <bool isConst>
+    class Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<isConst, const T*, T*>;
+        using reference = std::conditional_t<isConst, const T&, T&>;
+
+        Iterator() = default;
+        template <bool isOtherConst> requires (isConst && !isOtherConst)
+        Iterator(const Iterator<isOtherConst> &other) : _node(other._node), _list(other._list) {}
+
+        reference operator* () const { return _node->value; }
+        pointer operator-> () const { return &_node->value; }
+        Iterator& operator++ () { _node = _node->next; _list->_stats.stepped(); return *this; }
+        Iterator& operator-- () { _node = _node ? _node->prev : _list->_tail; _list->_stats.stepped(); return *this; }
+        Iterator operator++ (int) { Iterator temp = *this; ++*this; return temp; }
+        Iterator operator-- (int) { Iterator temp = *this; --*this; return temp; }
+        bool operator== (const Iterator &rhs) const { return _node == rhs._node; }
+
+        /// Node under the cursor (nullptr for end)
+        [[nodiscard]] Node<T> * node() const { return _node; }
+
+    private:
+        Node<T> *_node = nullptr;
+        const List *_list = nullptr;
+
+        Iterator(Node<T> *node, const List *list) : _node(node), _list(list) {}
+        friend class List;
+        friend class Iterator<!isConst>;
+    };
+
+    using value_type = T;
+    using allocator_type = Allocator;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
 private:
-    struct Node *_head = nullptr;
-    struct Node *_tail = nullptr;
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node<T>>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+    using Pool = NodePool<Node<T>, NodeAllocator>;
+
+    Node<T> *_head = nullptr;
+    Node<T> *_tail = nullptr;
     unsigned _size = 0;
+    [[no_unique_address]] NodeAllocator _alloc;
+    std::shared_ptr<Pool> _pool;  // Node storage if the list is pooled, allocator otherwise. Shared by split lists
+    std::unique_ptr<ListIndex<Node<T>>> _index;  // Positional index if the list is indexed
+    [[no_unique_address]] mutable Stats _stats;   // Counters, empty unless ADS_STATS is defined
+
+    template <typename... Args>
+    Node<T> * createNode(Args&&...);
+    void destroyNode(Node<T>*);
+    void swapNodes(Node<T>*, Node<T>*);
+    void linkChain(Node<T>*, Node<T>*, Node<T>*);
+    void unlinkChain(Node<T>*, Node<T>*);
+    void invalidateIndex();
+    void adopt(Node<T>*, Node<T>*, unsigned);
+    template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+    void linkRange(InputIt, Sentinel);
+
+    friend class ConcurrentList<T, Allocator>;
 public:
     // Constructors and destructor
     List();
-    explicit List(unsigned size, int value = 0);
-    explicit List(unsigned, const int*);
+    explicit List(const Allocator&);
+    explicit List(unsigned size, const T &value = T(), bool isPooled = false);
+    explicit List(unsigned, const T*, bool isPooled = false);
+    explicit List(std::span<const T>, bool isPooled = false);
+    explicit List(std::istream&, bool isPooled = false);
     List(const List&);
+    List(List&&) noexcept;
     ~List();
 
     // Operators
     List& operator= (const List&);
-    friend std::ostream& operator<< (std::ostream&, const List&);
-    struct Node * operator[] (int);
+    List& operator= (List&&) noexcept;
+    Node<T> * operator[] (int);
     bool operator> (const List&) const;
     bool operator< (const List&) const;
 
+    // Iterators
+    iterator begin();
+    iterator end();
+    [[nodiscard]] const_iterator begin() const;
+    [[nodiscard]] const_iterator end() const;
+    reverse_iterator rbegin();
+    reverse_iterator rend();
+    [[nodiscard]] const_reverse_iterator rbegin() const;
+    [[nodiscard]] const_reverse_iterator rend() const;
+
     // Methods
     void clear();
+    template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+    void assign(InputIt, Sentinel);
+    template <std::ranges::input_range Range>
+    void append_range(Range&&);
     void reverse();
-    struct Node * get(int);
-    int find(int);
-    void append(int);
-    void insert(unsigned, int);
+    Node<T> * get(int);
+    int find(const T&) const;
+    void append(const T&);
+    void append(T&&);
+    template <typename... Args>
+    T& emplace_back(Args&&...);
+    void insert(unsigned, const T&);
     void remove(unsigned);
     void swap(unsigned, unsigned);
+    iterator insert(iterator, const T&);
+    iterator insert(iterator, T&&);
+    template <typename... Args>
+    iterator emplace(iterator, Args&&...);
+    iterator erase(iterator);
+    void swap(iterator, iterator);
+    void splice(iterator, List&);
+    void splice(iterator, List&, iterator);
+    void splice(iterator, List&, iterator, iterator);
+    void concat(List&&);
+    List split(unsigned);
+    void setPooled(bool);
+    [[nodiscard]] bool isPooled() const;
+    void setIndexed(bool);
+    [[nodiscard]] bool isIndexed() const;
+    [[nodiscard]] const Stats& getStats() const;
+    void resetStats();
     [[nodiscard]] unsigned getSize() const;
     [[nodiscard]] bool isEmpty() const;
 };
 
 
+/// Default constructor. Size = 0, head & tail = nullptr
+template <typename T, typename Allocator>
+List<T, Allocator>::List() = default;
+
+
+/// Create empty list that takes nodes from the given allocator
+template <typename T, typename Allocator>
+List<T, Allocator>::List(const Allocator &alloc) : _alloc(alloc) {}
+
+
+/// Allocate a node from the pool or from the allocator and construct the value in place
+template <typename T, typename Allocator>
+template <typename... Args>
+Node<T> * List<T, Allocator>::createNode(Args&&... args) {
+    Node<T> *node = _pool ? _pool->allocate() : NodeTraits::allocate(_alloc, 1);
+    NodeTraits::construct(_alloc, node, std::forward<Args>(args)...);
+    _stats.allocated(sizeof(Node<T>));
+    return node;
+}
+
+
+/// Destroy the value and return the node to the storage it was taken from
+template <typename T, typename Allocator>
+void List<T, Allocator>::destroyNode(Node<T> *node) {
+    NodeTraits::destroy(_alloc, node);
+    if (_pool) _pool->deallocate(node);
+    else NodeTraits::deallocate(_alloc, node, 1);
+    _stats.freed(sizeof(Node<T>));
+}
+
+
+/// Relink two nodes so that they exchange their positions
+template <typename T, typename Allocator>
+void List<T, Allocator>::swapNodes(Node<T> *node1, Node<T> *node2) {
+    if (node1 == node2) return;
+
+    // Head and tail cases
+    if (_head == node1) _head = node2;
+    else if (_head == node2) _head = node1;
+    if (_tail == node1) _tail = node2;
+    else if (_tail == node2) _tail = node1;
+
+    // Update 'next' elements and update the 'prev' pointers of the 'next' nodes if exist
+    Node<T> *temp = node1->next;
+    node1->next = node2->next;
+    node2->next = temp;
+    if (node1->next) node1->next->prev = node1;
+    if (node2->next) node2->next->prev = node2;
+
+    // Update 'prev' elements and update the 'next' pointers of the 'prev' nodes if exist
+    temp = node1->prev;
+    node1->prev = node2->prev;
+    node2->prev = temp;
+    if (node1->prev) node1->prev->next = node1;
+    if (node2->prev) node2->prev->next = node2;
+}
+
+
+/// Link the chain [first, last] before the node (nullptr to link after the tail). Size is not updated
+template <typename T, typename Allocator>
+void List<T, Allocator>::linkChain(Node<T> *pos, Node<T> *first, Node<T> *last) {
+    Node<T> *prev = pos ? pos->prev : _tail;
+    first->prev = prev;
+    last->next = pos;
+    prev ? prev->next = first : _head = first;
+    pos ? pos->prev = last : _tail = last;
+}
+
+
+/// Unlink the chain [first, last] from the list. Nodes are not freed, size is not updated
+template <typename T, typename Allocator>
+void List<T, Allocator>::unlinkChain(Node<T> *first, Node<T> *last) {
+    first->prev ? first->prev->next = last->next : _head = last->next;
+    last->next ? last->next->prev = first->prev : _tail = first->prev;
+    first->prev = nullptr;
+    last->next = nullptr;
+}
+
+
+/// Mark the positional index as outdated after the nodes were relinked bypassing it
+template <typename T, typename Allocator>
+void List<T, Allocator>::invalidateIndex() {
+    if (_index) _index->invalidate();
+}
+
+
+/**
+ * Take the ready chain of nodes allocated by the allocator of this list. The list must be empty and not pooled
+ * @param[in] head - first node of the chain
+ * @param[in] tail - last node of the chain
+ * @param[in] size - amount of nodes in the chain
+ */
+template <typename T, typename Allocator>
+void List<T, Allocator>::adopt(Node<T> *head, Node<T> *tail, unsigned size) {
+    _head = head;
+    _tail = tail;
+    _size = size;
+    _stats.sized(_size);
+    invalidateIndex();
+}
+
+
+/**
+ * Append the values of the range in one pass. If the length of the range is known in advance,
+ * pooled nodes are taken as one contiguous run, so building is a sequential write
+ * @param[in] first - iterator to the first value
+ * @param[in] last - iterator or sentinel past the last value
+ */
+template <typename T, typename Allocator>
+template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+void List<T, Allocator>::linkRange(InputIt first, Sentinel last) {
+    Node<T> *run = nullptr;
+    if constexpr (std::forward_iterator<InputIt>) {
+        if (_pool) {
+            auto count = std::ranges::distance(first, last);
+            if (count == 0) return;
+            run = _pool->allocate(unsigned(count));
+            _stats.allocated(count * sizeof(Node<T>));
+        }
+    }
+
+    // Link each node to the previous one, 'next' of the new tail is already nullptr
+    Node<T> *prev = _tail;
+    unsigned count = 0;
+    for (; first != last; ++first, ++count) {
+        Node<T> *node = run ? run + count : _pool ? _pool->allocate() : NodeTraits::allocate(_alloc, 1);
+        NodeTraits::construct(_alloc, node, *first);
+        if (!run) _stats.allocated(sizeof(Node<T>));
+        node->prev = prev;
+        prev ? prev->next = node : _head = node;
+        prev = node;
+    }
+
+    _tail = prev;
+    _size += count;
+    _stats.sized(_size);
+    invalidateIndex();
+}
+
+
+/**
+ * Create doubly-linked list filled with def. value
+ * @param[in] size - amount of nodes
+ * @param[in] value - default value (def. = T())
+ * @param[in] isPooled - take nodes from the own pool instead of the allocator (def. = false)
+ */
+template <typename T, typename Allocator>
+List<T, Allocator>::List(unsigned size, const T &value, bool isPooled) {
+    if (isPooled) _pool = std::make_shared<Pool>(_alloc);
+
+    // Create DLL starting from the head node
+    for (unsigned i = 0; i < size; ++i)
+        append(value);
+}
+
+
+/**
+ * Create doubly-linked list filled with given values
+ * @param[in] size - amount of nodes
+ * @param[in] values - values of list
+ * @param[in] isPooled - take nodes from the own pool instead of the allocator (def. = false)
+ */
+template <typename T, typename Allocator>
+List<T, Allocator>::List(unsigned size, const T *values, bool isPooled)
+    : List(std::span<const T>(values, size), isPooled) {}
+
+
+/**
+ * Create doubly-linked list filled with given values in one pass
+ * @param[in] values - values of list
+ * @param[in] isPooled - take nodes from the own pool instead of the allocator (def. = false)
+ */
+template <typename T, typename Allocator>
+List<T, Allocator>::List(std::span<const T> values, bool isPooled) {
+    if (isPooled) _pool = std::make_shared<Pool>(_alloc);
+    linkRange(values.begin(), values.end());
+}
+
+
+/**
+ * Create doubly-linked list filled with values read from the stream until the end or the first invalid value
+ * @param[in] is - stream to read from
+ * @param[in] isPooled - take nodes from the own pool instead of the allocator (def. = false)
+ */
+template <typename T, typename Allocator>
+List<T, Allocator>::List(std::istream &is, bool isPooled) {
+    if (isPooled) _pool = std::make_shared<Pool>(_alloc);
+    linkRange(std::istream_iterator<T>(is), std::istream_iterator<T>());
+}
+
+
+/**
+ * Deep copy constructor. The copy uses the same kind of storage as the original
+ * @param[in] other - list from which the copy is taken
+ */
+template <typename T, typename Allocator>
+List<T, Allocator>::List(const List &other)
+    : _alloc(NodeTraits::select_on_container_copy_construction(other._alloc)) {
+    if (other.isPooled()) _pool = std::make_shared<Pool>(_alloc);
+    if (other.isIndexed()) _index = std::make_unique<ListIndex<Node<T>>>();
+    linkRange(other.begin(), other.end());
+}
+
+
+/**
+ * Move constructor. Nodes, their storage and index are taken from the other list, which becomes empty
+ * @param[in] other - list to move from
+ */
+template <typename T, typename Allocator>
+List<T, Allocator>::List(List &&other) noexcept
+    : _head(other._head), _tail(other._tail), _size(other._size), _alloc(std::move(other._alloc)),
+      _pool(std::move(other._pool)), _index(std::move(other._index)), _stats(std::exchange(other._stats, {})) {
+    other._head = nullptr;
+    other._tail = nullptr;
+    other._size = 0;
+}
+
+
+/// Free the memory allocated for a DLL
+template <typename T, typename Allocator>
+List<T, Allocator>::~List() {
+    clear();
+}
+
+
+/// Assignment operator. Storage kind of the list is kept
+template <typename T, typename Allocator>
+List<T, Allocator>& List<T, Allocator>::operator= (const List &rhs) {
+    // Self-assignment handler
+    if (this == &rhs) return *this;
+
+    // Clear the existing list
+    clear();
+
+    // Copy nodes from rhs to this list
+    linkRange(rhs.begin(), rhs.end());
+
+    return *this;
+}
+
+
+/// Move assignment operator. Nodes and their storage are taken from rhs, which becomes empty. Index mode is kept
+template <typename T, typename Allocator>
+List<T, Allocator>& List<T, Allocator>::operator= (List &&rhs) noexcept {
+    // Self-assignment handler
+    if (this == &rhs) return *this;
+
+    // Clear the existing list and steal the nodes
+    clear();
+    _head = rhs._head;
+    _tail = rhs._tail;
+    _size = rhs._size;
+    _alloc = std::move(rhs._alloc);
+    _pool = std::move(rhs._pool);
+    rhs._head = nullptr;
+    rhs._tail = nullptr;
+    rhs._size = 0;
+    if (rhs._index) rhs._index->clear();
+    invalidateIndex();
+    _stats += std::exchange(rhs._stats, {});
+
+    return *this;
+}
+
+
+/// Print the list
+template <typename T, typename Allocator>
+std::ostream& operator<< (std::ostream &os, const List<T, Allocator> &list) {
+    for (const T &value : list)
+        os << value << ' ';
+    return os;
+}
+
+
+/// Get node by it's index via [] operator
+template <typename T, typename Allocator>
+Node<T> * List<T, Allocator>::operator[] (int index) {
+    return get(index);
+}
+
+
+/// Is greater than rhs. Compared value is size
+template <typename T, typename Allocator>
+bool List<T, Allocator>::operator> (const List &list) const {
+    return _size > list.getSize();
+}
+
+
+/// Is less than rhs. Compared value is size
+template <typename T, typename Allocator>
+bool List<T, Allocator>::operator< (const List &list) const {
+    return _size < list.getSize();
+}
+
+
+/// Iterator to the first element
+template <typename T, typename Allocator>
+typename List<T, Allocator>::iterator List<T, Allocator>::begin() {
+    return {_head, this};
+}
+
+
+/// Iterator past the last element
+template <typename T, typename Allocator>
+typename List<T, Allocator>::iterator List<T, Allocator>::end() {
+    return {nullptr, this};
+}
+
+
+/// Const iterator to the first element
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_iterator List<T, Allocator>::begin() const {
+    return {_head, this};
+}
+
+
+/// Const iterator past the last element
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_iterator List<T, Allocator>::end() const {
+    return {nullptr, this};
+}
+
+
+/// Reverse iterator to the last element
+template <typename T, typename Allocator>
+typename List<T, Allocator>::reverse_iterator List<T, Allocator>::rbegin() {
+    return reverse_iterator(end());
+}
+
+
+/// Reverse iterator before the first element
+template <typename T, typename Allocator>
+typename List<T, Allocator>::reverse_iterator List<T, Allocator>::rend() {
+    return reverse_iterator(begin());
+}
+
+
+/// Const reverse iterator to the last element
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_reverse_iterator List<T, Allocator>::rbegin() const {
+    return const_reverse_iterator(end());
+}
+
+
+/// Const reverse iterator before the first element
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_reverse_iterator List<T, Allocator>::rend() const {
+    return const_reverse_iterator(begin());
+}
+
+
+/// Clear the list. Set head & tail to nullptr. Pooled nodes are released at once unless the pool is shared
+template <typename T, typename Allocator>
+void List<T, Allocator>::clear() {
+    if (_pool && _pool.use_count() == 1) {
+        // Values with trivial destructors don't need the walk
+        if constexpr (!std::is_trivially_destructible_v<T>)
+            for (Node<T> *current = _head; current; current = current->next)
+                NodeTraits::destroy(_alloc, current);
+        _pool->release();
+        _stats.freed(_size * sizeof(Node<T>));
+    } else {
+        while (_head) {
+            Node<T> *temp = _head;
+            _head = _head->next;
+            destroyNode(temp);
+        }
+    }
+    _head = nullptr;
+    _tail = nullptr;
+    _size = 0;
+    if (_index) _index->clear();
+}
+
+
+/**
+ * Replace the contents of the list with the values of the range. Storage kind of the list is kept
+ * @param[in] first - iterator to the first value
+ * @param[in] last - iterator or sentinel past the last value
+ */
+template <typename T, typename Allocator>
+template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+void List<T, Allocator>::assign(InputIt first, Sentinel last) {
+    clear();
+    linkRange(first, last);
+}
+
+
+/// Add the values of the range to the end of the list in one pass
+template <typename T, typename Allocator>
+template <std::ranges::input_range Range>
+void List<T, Allocator>::append_range(Range &&range) {
+    linkRange(std::ranges::begin(range), std::ranges::end(range));
+}
+
+
+/// Reverse the list
+template <typename T, typename Allocator>
+void List<T, Allocator>::reverse() {
+    // Accessing an element is a difficult operation for lists,
+    // so swap pointers not the values themselves
+    Node<T> *current = _head;
+    Node<T> *prev = nullptr;
+    Node<T> *next;
+
+    // Swap pointers
+    while (current) {
+        next = current->next;
+        current->next = prev;
+        current->prev = next;
+        prev = current;
+        current = next;
+    }
+
+    // And update head and tail
+    std::swap(_head, _tail);
+    invalidateIndex();
+}
+
+
+/// Add copy of the element to the end of the list
+template <typename T, typename Allocator>
+void List<T, Allocator>::append(const T &value) {
+    emplace_back(value);
+}
+
+
+/// Move the element to the end of the list
+template <typename T, typename Allocator>
+void List<T, Allocator>::append(T &&value) {
+    emplace_back(std::move(value));
+}
+
+
+/**
+ * Construct the element in place at the end of the list
+ * @param[in] args - arguments forwarded to the constructor of T
+ * @return reference to the new element
+ */
+template <typename T, typename Allocator>
+template <typename... Args>
+T& List<T, Allocator>::emplace_back(Args&&... args) {
+    Node<T> *newNode = createNode(std::forward<Args>(args)...);
+
+    if (isEmpty()) {  // List empty. Set both head and tail to the new node
+        _head = newNode;
+        _tail = newNode;
+    } else {          // List is not empty. Update the tail
+        _tail->next = newNode;
+        newNode->prev = _tail;
+        _tail = newNode;
+    }
+
+    _size++;
+    _stats.sized(_size);
+    if (_index && !_index->isStale()) _index->appended(newNode, _size - 1);
+    return newNode->value;
+}
+
+
+/// Get node by it's index
+template <typename T, typename Allocator>
+Node<T> * List<T, Allocator>::get(int index) {
+    if (isEmpty()) {
+        std::cout << "IndexError: The list is empty\n";
+        return nullptr;
+    }
+
+    // Normalize the index, negative one counts from the end
+    unsigned distance = index < 0 ? 0u - unsigned(index) : unsigned(index);
+    if (distance > getSize()) {
+        std::cout << "IndexError: Index out of range\n";
+        return nullptr;
+    }
+    unsigned position = index < 0 ? getSize() - distance : distance;
+
+    // Search via the positional index
+    if (_index) {
+        if (position == getSize()) {
+            std::cout << "IndexError: Index out of range\n";
+            return nullptr;
+        }
+        if (_index->isStale()) _index->build(_head, _size);
+        return _index->get(_head, position);
+    }
+
+    // Traverse to the index or throw an error
+    Node<T> *node = _head;
+    for (unsigned i = 0; i < position; ++i) {
+        if (!node->next) {
+            std::cout << "IndexError: Index out of range\n";
+            return nullptr;
+        }
+        node = node->next;
+    }
+    _stats.walked(position);
+
+    return node;
+}
+
+
+/// Return index if element found else -1
+template <typename T, typename Allocator>
+int List<T, Allocator>::find(const T &value) const {
+    // Traverse while not found
+    int i = 0;
+    for (Node<T> *node = _head; node; node = node->next, ++i)
+        if (node->value == value) return i;
+    return -1;
+}
+
+
+/// Add element to the specified position
+template <typename T, typename Allocator>
+void List<T, Allocator>::insert(unsigned index, const T &value) {
+    Node<T> *found = get(int(index));
+
+    // IndexError
+    if (!found) return;
+
+    // Insert
+    Node<T> *newNode = createNode(value);
+    newNode->prev = found->prev;
+    newNode->next = found;
+    if (newNode->prev) newNode->prev->next = newNode;
+    if (newNode->next) newNode->next->prev = newNode;
+    if (index == 0) _head = newNode;
+    _size++;
+    _stats.sized(_size);
+    if (_index) _index->inserted(newNode, index);
+}
+
+
+/// Remove element by it's index
+template <typename T, typename Allocator>
+void List<T, Allocator>::remove(unsigned index) {
+    if (isEmpty()) return;
+
+    // Find
+    Node<T> *found = get(int(index));
+    if (!found) return;
+    if (_index) _index->removed(index);
+
+    // Delete
+    found->prev ? found->prev->next = found->next : _head = found->next; // Update prev node or update the head if null
+    found->next ? found->next->prev = found->prev : _tail = found->prev; // Update next node or update the tail if null
+    destroyNode(found);
+    _size--;
+}
+
+
+/// Swap two nodes by their indexes
+template <typename T, typename Allocator>
+void List<T, Allocator>::swap(unsigned i1, unsigned i2) {
+    // (Empty || 1 element || Same indexes) => no swap
+    if (isEmpty() || _head == _tail || i1 == i2) return;
+
+    // 1st index less than 2nd one
+    if (i1 > i2) std::swap(i1, i2);
+
+    // Get nodes. If not found -> return
+    Node<T> *node1 = get(int(i1));
+    Node<T> *node2 = get(int(i2));
+    if (!node1 || !node2) return;
+
+    swapNodes(node1, node2);
+    if (_index) {
+        _index->replaced(i1, node2);
+        _index->replaced(i2, node1);
+    }
+}
+
+
+/// Insert copy of the element before the cursor in O(1). Return cursor to the inserted node
+template <typename T, typename Allocator>
+typename List<T, Allocator>::iterator List<T, Allocator>::insert(iterator pos, const T &value) {
+    return emplace(pos, value);
+}
+
+
+/// Move the element before the cursor in O(1). Return cursor to the inserted node
+template <typename T, typename Allocator>
+typename List<T, Allocator>::iterator List<T, Allocator>::insert(iterator pos, T &&value) {
+    return emplace(pos, std::move(value));
+}
+
+
+/**
+ * Construct the element in place before the cursor in O(1)
+ * @param[in] pos - cursor to the node to insert before (end() to append)
+ * @param[in] args - arguments forwarded to the constructor of T
+ * @return cursor to the inserted node
+ */
+template <typename T, typename Allocator>
+template <typename... Args>
+typename List<T, Allocator>::iterator List<T, Allocator>::emplace(iterator pos, Args&&... args) {
+    if (!pos._node) {
+        emplace_back(std::forward<Args>(args)...);
+        return {_tail, this};
+    }
+
+    Node<T> *newNode = createNode(std::forward<Args>(args)...);
+    newNode->prev = pos._node->prev;
+    newNode->next = pos._node;
+    newNode->prev ? newNode->prev->next = newNode : _head = newNode;
+    pos._node->prev = newNode;
+    _size++;
+    _stats.sized(_size);
+    invalidateIndex();
+
+    return {newNode, this};
+}
+
+
+/**
+ * Remove the node under the cursor in O(1)
+ * @param[in] pos - cursor to an existing node
+ * @return cursor to the node following the removed one
+ */
+template <typename T, typename Allocator>
+typename List<T, Allocator>::iterator List<T, Allocator>::erase(iterator pos) {
+    Node<T> *found = pos._node;
+    if (!found) return end();
+
+    Node<T> *next = found->next;
+    found->prev ? found->prev->next = found->next : _head = found->next;
+    found->next ? found->next->prev = found->prev : _tail = found->prev;
+    destroyNode(found);
+    _size--;
+    invalidateIndex();
+
+    return {next, this};
+}
+
+
+/// Swap two nodes under the cursors in O(1). Cursors keep pointing to the same (moved) nodes
+template <typename T, typename Allocator>
+void List<T, Allocator>::swap(iterator it1, iterator it2) {
+    if (!it1._node || !it2._node) return;
+    swapNodes(it1._node, it2._node);
+    invalidateIndex();
+}
+
+
+/**
+ * Move all the nodes of the other list before the cursor. O(1) if both lists use the same storage
+ * (allocator or a shared pool), otherwise values are moved one by one. The other list becomes empty
+ * @param[in] pos - cursor to insert before (end() to append)
+ * @param[in] other - list to take the nodes from
+ */
+template <typename T, typename Allocator>
+void List<T, Allocator>::splice(iterator pos, List &other) {
+    if (&other == this || other.isEmpty()) return;
+
+    // Different storage. Nodes can't be relinked
+    if (_pool != other._pool || _alloc != other._alloc) {
+        for (T &value : other) emplace(pos, std::move(value));
+        other.clear();
+        return;
+    }
+
+    Node<T> *first = other._head, *last = other._tail;
+    other.unlinkChain(first, last);
+    linkChain(pos._node, first, last);
+    _size += other._size;
+    other._size = 0;
+    _stats.sized(_size);
+    _stats += std::exchange(other._stats, {});
+    invalidateIndex();
+    if (other._index) other._index->clear();
+}
+
+
+/**
+ * Move one node of the other list before the cursor. O(1) if both lists use the same storage
+ * @param[in] pos - cursor to insert before (end() to append)
+ * @param[in] other - list to take the node from (may be this list)
+ * @param[in] it - cursor to the node of the other list
+ */
+template <typename T, typename Allocator>
+void List<T, Allocator>::splice(iterator pos, List &other, iterator it) {
+    if (!it._node || it == pos) return;
+
+    // Different storage. Node can't be relinked
+    if (_pool != other._pool || _alloc != other._alloc) {
+        emplace(pos, std::move(*it));
+        other.erase(it);
+        return;
+    }
+
+    other.unlinkChain(it._node, it._node);
+    linkChain(pos._node, it._node, it._node);
+    other._size--;
+    _size++;
+    _stats.sized(_size);
+    invalidateIndex();
+    other.invalidateIndex();
+}
+
+
+/**
+ * Move the nodes [first, last) of the other list before the cursor. Relinking is O(1),
+ * counting the moved nodes is linear in their amount
+ * @param[in] pos - cursor to insert before (end() to append). Must not be inside the range
+ * @param[in] other - list to take the nodes from (may be this list)
+ * @param[in] first - cursor to the first node of the range
+ * @param[in] last - cursor past the last node of the range
+ */
+template <typename T, typename Allocator>
+void List<T, Allocator>::splice(iterator pos, List &other, iterator first, iterator last) {
+    if (first == last) return;
+
+    // Different storage. Nodes can't be relinked
+    if (_pool != other._pool || _alloc != other._alloc) {
+        while (first != last) {
+            emplace(pos, std::move(*first));
+            first = other.erase(first);
+        }
+        return;
+    }
+
+    auto count = unsigned(std::distance(first, last));
+    Node<T> *lastNode = last._node ? last._node->prev : other._tail;
+    other.unlinkChain(first._node, lastNode);
+    linkChain(pos._node, first._node, lastNode);
+    other._size -= count;
+    _size += count;
+    _stats.sized(_size);
+    invalidateIndex();
+    other.invalidateIndex();
+}
+
+
+/// Append all the nodes of the other list. O(1) if both lists use the same storage
+template <typename T, typename Allocator>
+void List<T, Allocator>::concat(List &&other) {
+    splice(end(), other);
+}
+
+
+/**
+ * Split the list in two. This list keeps [0, at), the returned one gets [at, size).
+ * Nodes are relinked, the returned list shares the storage and the index mode with this one
+ * @param[in] at - index of the first node of the second part
+ * @return list of the nodes starting from the index
+ */
+template <typename T, typename Allocator>
+List<T, Allocator> List<T, Allocator>::split(unsigned at) {
+    List result(_alloc);
+    result._pool = _pool;
+    if (_index) result.setIndexed(true);
+    if (at >= _size) return result;
+
+    // Walk from the closest end
+    Node<T> *node;
+    if (at < _size / 2) {
+        node = _head;
+        for (unsigned i = 0; i < at; ++i) node = node->next;
+    } else {
+        node = _tail;
+        for (unsigned i = _size - 1; i > at; --i) node = node->prev;
+    }
+
+    Node<T> *last = _tail;
+    unlinkChain(node, last);
+    result.linkChain(nullptr, node, last);
+    result._size = _size - at;
+    _size = at;
+    invalidateIndex();
+    result.invalidateIndex();
+
+    return result;
+}
+
+
+/**
+ * Switch the storage of nodes between the own pool and the allocator. Existing values are moved to the new storage
+ * @param[in] isPooled - take nodes from the own pool if true, from the allocator otherwise
+ */
+template <typename T, typename Allocator>
+void List<T, Allocator>::setPooled(bool isPooled) {
+    if (isPooled == this->isPooled()) return;
+
+    // Detach the nodes and rebuild the list in the new storage
+    Node<T> *current = _head;
+    std::shared_ptr<Pool> oldPool = std::move(_pool);
+    _head = nullptr;
+    _tail = nullptr;
+    _size = 0;
+    if (_index) _index->clear();
+    if (isPooled) _pool = std::make_shared<Pool>(_alloc);
+
+    while (current) {
+        Node<T> *temp = current;
+        current = current->next;
+        emplace_back(std::move(temp->value));
+        NodeTraits::destroy(_alloc, temp);
+        if (oldPool) oldPool->deallocate(temp);
+        else NodeTraits::deallocate(_alloc, temp, 1);
+        _stats.freed(sizeof(Node<T>));
+    }
+}
+
+
+/// Return true if nodes are taken from the own pool
+template <typename T, typename Allocator>
+bool List<T, Allocator>::isPooled() const {
+    return _pool != nullptr;
+}
+
+
+/**
+ * Switch the positional index on or off. Indexed list does get, insert and remove by index in O(log n)
+ * @param[in] isIndexed - keep the index if true
+ */
+template <typename T, typename Allocator>
+void List<T, Allocator>::setIndexed(bool isIndexed) {
+    if (isIndexed == this->isIndexed()) return;
+    if (isIndexed) {
+        _index = std::make_unique<ListIndex<Node<T>>>();
+        _index->build(_head, _size);
+    } else {
+        _index = nullptr;
+    }
+}
+
+
+/// Return true if the list keeps the positional index
+template <typename T, typename Allocator>
+bool List<T, Allocator>::isIndexed() const {
+    return _index != nullptr;
+}
+
+
+/// Return the counters of the list (empty unless ADS_STATS is defined)
+template <typename T, typename Allocator>
+const Stats& List<T, Allocator>::getStats() const {
+    return _stats;
+}
+
+
+/// Reset the counters of the list
+template <typename T, typename Allocator>
+void List<T, Allocator>::resetStats() {
+    _stats = {};
+}
+
+
+/// Return size of the list
+template <typename T, typename Allocator>
+unsigned List<T, Allocator>::getSize() const {
+    return _size;
+}
+
+
+/// Return false if list is empty else true
+template <typename T, typename Allocator>
+bool List<T, Allocator>::isEmpty() const {
+    return _size == 0;
+}
+
+
 #endif //PRACTICE01_DL_LIST_H
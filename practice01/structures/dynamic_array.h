@@ -1,36 +1,592 @@
 #ifndef PRACTICE01_DYNAMIC_ARRAY_H
 #define PRACTICE01_DYNAMIC_ARRAY_H
 
+#include "stats.h"
+#include "simd_search.h"
 #include <iostream>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include <cstring>
 
+
+/// Uninitialized storage for N elements inside the array object
+template <typename T, unsigned N>
+struct InlineStorage {
+    alignas(T) unsigned char bytes[N * sizeof(T)];
+    T * data() { return reinterpret_cast<T*>(bytes); }
+    const T * data() const { return reinterpret_cast<const T*>(bytes); }
+};
+
+
+/// No inline storage
+template <typename T>
+struct InlineStorage<T, 0> {
+    T * data() { return nullptr; }
+    const T * data() const { return nullptr; }
+};
+
+
+/**
+ * @class DArray
+ * @brief Dynamic array of values of any type
+ * Capacity grows geometrically (at least twice), so appending is amortized O(1). Elements are relocated
+ * by memcpy if T is trivially copyable and by move otherwise. No memory is allocated until the first element.
+ * Up to N elements are stored inside the object, the heap is used only past N (see SmallDArray).
+ * Searches over int arrays run on the SIMD kernels (see SimdSearch)
+ * @tparam T - type of the values
+ * @tparam N - amount of the elements stored inline (def. = 0)
+ */
+template <typename T, unsigned N = 0>
 class DArray {
+public:
+    static constexpr unsigned INITIAL_CAPACITY = 10;
+
 private:
+    [[no_unique_address]] InlineStorage<T, N> buffer;
     unsigned size = 0;
-    unsigned capacity = 10;
-    int * array = new int[capacity];
+    unsigned capacity = N;
+    T * array = buffer.data();
+    [[no_unique_address]] Stats stats;  // Counters, empty unless ADS_STATS is defined
+
+    static T * allocate(unsigned);
+    void deallocate();
+    void relocate(T*, unsigned);
+    void take(DArray&&);
+    [[nodiscard]] unsigned grownCapacity(unsigned) const;
 public:
     // Constructors and destructor
     DArray();
-    explicit DArray(unsigned size, int value = 0);
-    explicit DArray(unsigned, const int*);
+    explicit DArray(unsigned size, const T &value = T());
+    explicit DArray(unsigned, const T*);
+    DArray(const DArray&);
+    DArray(DArray&&) noexcept;
     ~DArray();
 
     // Operators
     DArray& operator= (const DArray&);
-    friend std::ostream& operator<< (std::ostream&, DArray&);
-    int * operator[] (int);
+    DArray& operator= (DArray&&) noexcept;
+    T * operator[] (int);
+
+    // Iterators
+    T * begin();
+    T * end();
+    [[nodiscard]] const T * begin() const;
+    [[nodiscard]] const T * end() const;
 
     // Methods
-    int * get(int);
-    int find(int);
+    T * get(int);
+    [[nodiscard]] int find(const T&) const;
+    [[nodiscard]] unsigned count(const T&) const;
+    [[nodiscard]] DArray<int> findAll(const T&) const;
+    [[nodiscard]] T min() const;
+    [[nodiscard]] T max() const;
+    [[nodiscard]] bool containsAny(const DArray&) const;
+    [[nodiscard]] DArray<int> findBatch(const DArray&) const;
+    void clear();
+    void reserve(unsigned);
+    void shrink_to_fit();
     void resize(unsigned);
-    void append(int);
-    void insert(unsigned, int);
+    void append(const T&);
+    void append(T&&);
+    template <typename... Args>
+    T& emplace_back(Args&&...);
+    void insert(unsigned, const T&);
+    void insert(unsigned, T&&);
     void remove(unsigned);
+    T * data();
+    [[nodiscard]] const T * data() const;
     [[nodiscard]] unsigned getSize() const;
     [[nodiscard]] unsigned getCapacity() const;
     [[nodiscard]] bool isEmpty() const;
+    [[nodiscard]] bool isInline() const;
+    [[nodiscard]] const Stats& getStats() const;
+    void resetStats();
 };
 
 
+/// Allocate uninitialized storage for the given amount of elements
+template <typename T, unsigned N>
+T * DArray<T, N>::allocate(unsigned count) {
+    return std::allocator<T>().allocate(count);
+}
+
+
+/// Destroy the elements and free the storage unless it's inline
+template <typename T, unsigned N>
+void DArray<T, N>::deallocate() {
+    if (!array) return;
+    std::destroy_n(array, size);
+    if (isInline()) return;
+    std::allocator<T>().deallocate(array, capacity);
+    stats.freed(capacity * sizeof(T));
+}
+
+
+/**
+ * Move the elements to the new storage and free the old one
+ * @param[in] newArray - storage for at least size elements
+ * @param[in] newCapacity - capacity of the new storage
+ */
+template <typename T, unsigned N>
+void DArray<T, N>::relocate(T *newArray, unsigned newCapacity) {
+    if (array) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (size) std::memcpy(static_cast<void*>(newArray), array, size * sizeof(T));
+        } else {
+            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+                std::uninitialized_move_n(array, size, newArray);
+            else
+                std::uninitialized_copy_n(array, size, newArray);
+        }
+        deallocate();
+        stats.reallocated();
+    }
+
+    array = newArray;
+    capacity = newCapacity;
+    if (array && !isInline()) stats.allocated(capacity * sizeof(T));
+}
+
+
+/**
+ * Take the elements of the other array, which becomes empty. Heap storage is stolen,
+ * inline elements are moved one by one. This array must have no elements and no heap storage
+ * @param[in] other - array to take from
+ */
+template <typename T, unsigned N>
+void DArray<T, N>::take(DArray &&other) {
+    if (other.isInline()) {
+        std::uninitialized_move_n(other.array, other.size, array);
+        size = other.size;
+        other.clear();
+    } else {
+        size = std::exchange(other.size, 0);
+        capacity = std::exchange(other.capacity, N);
+        array = std::exchange(other.array, other.buffer.data());
+    }
+    stats += std::exchange(other.stats, {});
+}
+
+
+/// Capacity for at least the required amount of elements. Grows at least twice, so appending is amortized O(1)
+template <typename T, unsigned N>
+unsigned DArray<T, N>::grownCapacity(unsigned required) const {
+    return std::max({required, capacity * 2, INITIAL_CAPACITY});
+}
+
+
+/// Default constructor. Nothing is allocated until the first element
+template <typename T, unsigned N>
+DArray<T, N>::DArray() = default;
+
+
+/// Creates dynArray with [n] copies of [value]
+template <typename T, unsigned N>
+DArray<T, N>::DArray(unsigned n, const T &value) {
+    reserve(n);
+    std::uninitialized_fill_n(array, n, value);
+    size = n;
+    stats.sized(size);
+}
+
+
+/// Creates dynArray by array values
+template <typename T, unsigned N>
+DArray<T, N>::DArray(unsigned n, const T *values) {
+    reserve(n);
+    std::uninitialized_copy_n(values, n, array);
+    size = n;
+    stats.sized(size);
+}
+
+
+/// Copy constructor. The copy gets exactly as much capacity as needed
+template <typename T, unsigned N>
+DArray<T, N>::DArray(const DArray &other) : DArray(other.size, other.array) {}
+
+
+/// Move constructor. Storage is taken from the other array, which becomes empty
+template <typename T, unsigned N>
+DArray<T, N>::DArray(DArray &&other) noexcept {
+    take(std::move(other));
+}
+
+
+/// Destructor
+template <typename T, unsigned N>
+DArray<T, N>::~DArray() {
+    deallocate();
+}
+
+
+/// Assignment operator
+template <typename T, unsigned N>
+DArray<T, N>& DArray<T, N>::operator= (const DArray &rhs) {
+    // Self-assignment handler
+    if (this == &rhs) return *this;
+
+    // Reuse the storage if it's large enough
+    if (rhs.size > capacity) return *this = DArray(rhs);
+
+    clear();
+    std::uninitialized_copy_n(rhs.array, rhs.size, array);
+    size = rhs.size;
+    stats.sized(size);
+
+    return *this;
+}
+
+
+/// Move assignment operator. Storage is taken from rhs, which becomes empty
+template <typename T, unsigned N>
+DArray<T, N>& DArray<T, N>::operator= (DArray &&rhs) noexcept {
+    // Self-assignment handler
+    if (this == &rhs) return *this;
+
+    deallocate();
+    size = 0;
+    capacity = N;
+    array = buffer.data();
+    take(std::move(rhs));
+
+    return *this;
+}
+
+
+/// Print the array
+template <typename T, unsigned N>
+std::ostream& operator<< (std::ostream& os, const DArray<T, N>& arr) {
+    for (const T &value : arr)
+        os << value << ' ';
+    return os;
+}
+
+
+/// Get element by it`s index via [] operator
+template <typename T, unsigned N>
+T * DArray<T, N>::operator[] (int index) {
+    return get(index);
+}
+
+
+/// Pointer to the first element
+template <typename T, unsigned N>
+T * DArray<T, N>::begin() {
+    return array;
+}
+
+
+/// Pointer past the last element
+template <typename T, unsigned N>
+T * DArray<T, N>::end() {
+    return array + size;
+}
+
+
+/// Const pointer to the first element
+template <typename T, unsigned N>
+const T * DArray<T, N>::begin() const {
+    return array;
+}
+
+
+/// Const pointer past the last element
+template <typename T, unsigned N>
+const T * DArray<T, N>::end() const {
+    return array + size;
+}
+
+
+/// Get element by it`s index
+template <typename T, unsigned N>
+T * DArray<T, N>::get(int index) {
+    if (isEmpty()) {
+        std::cout << "IndexError: The array is empty\n";
+        return nullptr;
+    } else if (index >= int(getSize()) || index < -int(getSize())) {
+        std::cout << "IndexError: Index out of range\n";
+        return nullptr;
+    } else if (index < 0) {
+        index = int(getSize()) + index;
+    }
+
+    return &array[index];
+}
+
+
+/// Return index if element found else -1
+template <typename T, unsigned N>
+int DArray<T, N>::find(const T &value) const {
+    if constexpr (std::is_same_v<T, int>) return SimdSearch::find(array, size, value);
+
+    for (unsigned i = 0; i < size; ++i)
+        if (array[i] == value) return int(i);
+    return -1;
+}
+
+
+/// Return amount of elements equal to the value
+template <typename T, unsigned N>
+unsigned DArray<T, N>::count(const T &value) const {
+    if constexpr (std::is_same_v<T, int>) return SimdSearch::count(array, size, value);
+
+    return unsigned(std::count(begin(), end(), value));
+}
+
+
+/// Return indexes of all the elements equal to the value in ascending order
+template <typename T, unsigned N>
+DArray<int> DArray<T, N>::findAll(const T &value) const {
+    DArray<int> indexes;
+    if constexpr (std::is_same_v<T, int>) {
+        indexes.resize(count(value));
+        SimdSearch::findAll(array, size, value, indexes.data());
+    } else {
+        for (unsigned i = 0; i < size; ++i)
+            if (array[i] == value) indexes.append(int(i));
+    }
+    return indexes;
+}
+
+
+/// Return the smallest element. Empty array gives T()
+template <typename T, unsigned N>
+T DArray<T, N>::min() const {
+    if (isEmpty()) {
+        std::cout << "IndexError: The array is empty\n";
+        return T();
+    }
+    if constexpr (std::is_same_v<T, int>) return SimdSearch::min(array, size);
+
+    return *std::min_element(begin(), end());
+}
+
+
+/// Return the largest element. Empty array gives T()
+template <typename T, unsigned N>
+T DArray<T, N>::max() const {
+    if (isEmpty()) {
+        std::cout << "IndexError: The array is empty\n";
+        return T();
+    }
+    if constexpr (std::is_same_v<T, int>) return SimdSearch::max(array, size);
+
+    return *std::max_element(begin(), end());
+}
+
+
+/// Return true if the array contains at least one of the values
+template <typename T, unsigned N>
+bool DArray<T, N>::containsAny(const DArray &values) const {
+    if constexpr (std::is_same_v<T, int>) return SimdSearch::containsAny(array, size, values.data(), values.getSize());
+
+    return std::find_first_of(begin(), end(), values.begin(), values.end()) != end();
+}
+
+
+/**
+ * Find the first occurrence of each key in one pass over the array
+ * @param[in] keys - values to search for
+ * @return index of each key or -1 if it's not found
+ */
+template <typename T, unsigned N>
+DArray<int> DArray<T, N>::findBatch(const DArray &keys) const {
+    DArray<int> indexes(keys.getSize(), -1);
+    if constexpr (std::is_same_v<T, int>) {
+        SimdSearch::findBatch(array, size, keys.data(), keys.getSize(), indexes.data());
+    } else {
+        for (unsigned i = 0; i < size; ++i)
+            for (unsigned k = 0; k < keys.getSize(); ++k)
+                if (indexes.data()[k] == -1 && keys.array[k] == array[i]) indexes.data()[k] = int(i);
+    }
+    return indexes;
+}
+
+
+/// Remove all the elements. Capacity is kept
+template <typename T, unsigned N>
+void DArray<T, N>::clear() {
+    std::destroy_n(array, size);
+    size = 0;
+}
+
+
+/// Make sure that the array holds at least the given amount of elements without reallocation
+template <typename T, unsigned N>
+void DArray<T, N>::reserve(unsigned newCapacity) {
+    if (newCapacity <= capacity) return;
+    relocate(allocate(newCapacity), newCapacity);
+}
+
+
+/// Reduce the capacity to the size. Elements that fit the inline storage are moved back to it
+template <typename T, unsigned N>
+void DArray<T, N>::shrink_to_fit() {
+    if (size == capacity || isInline()) return;
+    if (size <= N) relocate(buffer.data(), N);
+    else relocate(allocate(size), size);
+}
+
+
+/// Resize the array. New elements are value-initialized, capacity isn't reduced
+template <typename T, unsigned N>
+void DArray<T, N>::resize(unsigned newSize) {
+    // New size is smaller than the current one, truncate the array
+    if (newSize <= size) {
+        std::destroy(array + newSize, array + size);
+        size = newSize;
+        return;
+    }
+
+    // New size is larger than the current capacity. Grow geometrically
+    if (newSize > capacity) reserve(grownCapacity(newSize));
+
+    // Fill new elements with default value
+    std::uninitialized_value_construct(array + size, array + newSize);
+    size = newSize;
+    stats.sized(size);
+}
+
+
+/// Add copy of the element to the end
+template <typename T, unsigned N>
+void DArray<T, N>::append(const T &value) {
+    emplace_back(value);
+}
+
+
+/// Move the element to the end
+template <typename T, unsigned N>
+void DArray<T, N>::append(T &&value) {
+    emplace_back(std::move(value));
+}
+
+
+/**
+ * Construct the element in place at the end in amortized O(1)
+ * @param[in] args - arguments forwarded to the constructor of T. May refer to the elements of the array
+ * @return reference to the new element
+ */
+template <typename T, unsigned N>
+template <typename... Args>
+T& DArray<T, N>::emplace_back(Args&&... args) {
+    if (size == capacity) {
+        // Construct the element before the old storage is freed, args may point into it
+        unsigned newCapacity = grownCapacity(size + 1);
+        T *newArray = allocate(newCapacity);
+        ::new (static_cast<void*>(newArray + size)) T(std::forward<Args>(args)...);
+        relocate(newArray, newCapacity);
+    } else {
+        ::new (static_cast<void*>(array + size)) T(std::forward<Args>(args)...);
+    }
+
+    size++;
+    stats.sized(size);
+    return array[size - 1];
+}
+
+
+/// Add copy of the element to the specified position
+template <typename T, unsigned N>
+void DArray<T, N>::insert(unsigned index, const T &value) {
+    insert(index, T(value));
+}
+
+
+/// Move the element to the specified position
+template <typename T, unsigned N>
+void DArray<T, N>::insert(unsigned index, T &&value) {
+    // Index out of range
+    if (index >= size) {
+        std::cout << "IndexError: Index out of range\n";
+        return;
+    }
+
+    // Shift existing elements by one
+    emplace_back(std::move(array[size - 1]));
+    std::move_backward(array + index, array + size - 2, array + size - 1);
+
+    // Insert
+    array[index] = std::move(value);
+}
+
+
+/// Remove element by it`s index
+template <typename T, unsigned N>
+void DArray<T, N>::remove(unsigned index) {
+    if (index >= size) {
+        std::cout << "IndexError: Index out of range\n";
+        return;
+    }
+
+    // Shift elements
+    std::move(array + index + 1, array + size, array + index);
+    std::destroy_at(array + size - 1);
+    size--;
+}
+
+
+/// Pointer to the storage
+template <typename T, unsigned N>
+T * DArray<T, N>::data() {
+    return array;
+}
+
+
+/// Const pointer to the storage
+template <typename T, unsigned N>
+const T * DArray<T, N>::data() const {
+    return array;
+}
+
+
+/// Return size of the array
+template <typename T, unsigned N>
+unsigned DArray<T, N>::getSize() const {
+    return size;
+}
+
+
+/// Return capacity of the array
+template <typename T, unsigned N>
+unsigned DArray<T, N>::getCapacity() const {
+    return capacity;
+}
+
+
+/// Return false if list is empty else true
+template <typename T, unsigned N>
+bool DArray<T, N>::isEmpty() const {
+    return size == 0;
+}
+
+
+/// Return true if the elements are stored inside the object
+template <typename T, unsigned N>
+bool DArray<T, N>::isInline() const {
+    return N > 0 && array == buffer.data();
+}
+
+
+/// Return the counters of the array (empty unless ADS_STATS is defined)
+template <typename T, unsigned N>
+const Stats& DArray<T, N>::getStats() const {
+    return stats;
+}
+
+
+/// Reset the counters of the array
+template <typename T, unsigned N>
+void DArray<T, N>::resetStats() {
+    stats = {};
+}
+
+
+/// Dynamic array that stores up to N elements inline and allocates only past N
+template <typename T, unsigned N>
+using SmallDArray = DArray<T, N>;
+
+
 #endif //PRACTICE01_DYNAMIC_ARRAY_H
@@ -0,0 +1,407 @@
+#ifndef PRACTICE01_GAP_BUFFER_H
+#define PRACTICE01_GAP_BUFFER_H
+
+#include "stats.h"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <iostream>
+
+
+/**
+ * @class GapBuffer
+ * @brief Dynamic array with a gap of free slots at the last edited position
+ * Elements before the gap are stored at the start of the storage, elements after it at the end.
+ * insert() and remove() move the gap to the index first, which costs the distance from the previous
+ * edit, then take or give one slot of the gap. Edits clustered around a cursor are O(1) amortized,
+ * edits at random positions cost as much as in DArray. Capacity grows geometrically
+ * @tparam T - type of the values
+ */
+template <typename T>
+class GapBuffer {
+public:
+    static constexpr unsigned INITIAL_CAPACITY = 10;
+
+private:
+    T * array = nullptr;
+    unsigned capacity = 0;
+    unsigned gapStart = 0;  // Index of the first free slot
+    unsigned gapEnd = 0;    // Index of the slot after the last free one
+    [[no_unique_address]] Stats stats;
+
+    [[nodiscard]] unsigned slot(unsigned) const;
+    void moveGap(unsigned);
+    void relocate(unsigned);
+    void destroy();
+public:
+    // Constructors and destructor
+    GapBuffer();
+    explicit GapBuffer(unsigned size, const T &value = T());
+    explicit GapBuffer(unsigned, const T*);
+    GapBuffer(const GapBuffer&);
+    GapBuffer(GapBuffer&&) noexcept;
+    ~GapBuffer();
+
+    // Operators
+    GapBuffer& operator= (const GapBuffer&);
+    GapBuffer& operator= (GapBuffer&&) noexcept;
+    T * operator[] (int);
+
+    // Methods
+    T * get(int);
+    [[nodiscard]] const T * get(int) const;
+    [[nodiscard]] int find(const T&) const;
+    void clear();
+    void reserve(unsigned);
+    void append(const T&);
+    void append(T&&);
+    void insert(unsigned, const T&);
+    void insert(unsigned, T&&);
+    void remove(unsigned);
+    [[nodiscard]] unsigned getSize() const;
+    [[nodiscard]] unsigned getCapacity() const;
+    [[nodiscard]] unsigned getGapPosition() const;
+    [[nodiscard]] bool isEmpty() const;
+    [[nodiscard]] const Stats& getStats() const;
+    void resetStats();
+};
+
+
+/// Position of the element in the storage, skipping the gap
+template <typename T>
+unsigned GapBuffer<T>::slot(unsigned index) const {
+    return index < gapStart ? index : index + (gapEnd - gapStart);
+}
+
+
+/**
+ * Move the gap so that it starts at the index. Elements between the old and the new position
+ * are moved across the gap
+ * @param[in] index - new position of the gap, not greater than the size
+ */
+template <typename T>
+void GapBuffer<T>::moveGap(unsigned index) {
+    if (index == gapStart) return;
+
+    // Empty gap is between any two elements, nothing to move
+    if (gapStart == gapEnd) {
+        gapStart = gapEnd = index;
+        return;
+    }
+
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        // Moving left, [index, gapStart) goes to the end of the gap. Moving right, the elements after the gap go to it's start
+        if (index < gapStart) {
+            unsigned count = gapStart - index;
+            std::memmove(static_cast<void*>(array + gapEnd - count), array + index, count * sizeof(T));
+            gapEnd -= count;
+        } else {
+            unsigned count = index - gapStart;
+            std::memmove(static_cast<void*>(array + gapStart), array + gapEnd, count * sizeof(T));
+            gapEnd += count;
+        }
+        gapStart = index;
+    } else {
+        // Slots of the gap are uninitialized, so every element is constructed in the gap and destroyed in place
+        while (gapStart > index) {
+            --gapStart, --gapEnd;
+            std::construct_at(array + gapEnd, std::move(array[gapStart]));
+            std::destroy_at(array + gapStart);
+        }
+        while (gapStart < index) {
+            std::construct_at(array + gapStart, std::move(array[gapEnd]));
+            std::destroy_at(array + gapEnd);
+            ++gapStart, ++gapEnd;
+        }
+    }
+}
+
+
+/**
+ * Move the elements to the larger storage, the gap keeps it's position and gets the new slots
+ * @param[in] newCapacity - amount of elements the storage must hold
+ */
+template <typename T>
+void GapBuffer<T>::relocate(unsigned newCapacity) {
+    T *newArray = std::allocator<T>().allocate(newCapacity);
+    unsigned tail = capacity - gapEnd;
+
+    if (array) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (gapStart) std::memcpy(static_cast<void*>(newArray), array, gapStart * sizeof(T));
+            if (tail) std::memcpy(static_cast<void*>(newArray + newCapacity - tail), array + gapEnd, tail * sizeof(T));
+        } else {
+            std::uninitialized_move_n(array, gapStart, newArray);
+            std::uninitialized_move_n(array + gapEnd, tail, newArray + newCapacity - tail);
+        }
+        destroy();
+        stats.reallocated();
+    }
+
+    array = newArray;
+    capacity = newCapacity;
+    gapEnd = newCapacity - tail;
+    stats.allocated(capacity * sizeof(T));
+}
+
+
+/// Destroy the elements and free the storage
+template <typename T>
+void GapBuffer<T>::destroy() {
+    if (!array) return;
+    std::destroy_n(array, gapStart);
+    std::destroy(array + gapEnd, array + capacity);
+    std::allocator<T>().deallocate(array, capacity);
+    stats.freed(capacity * sizeof(T));
+}
+
+
+/// Default constructor. Nothing is allocated until the first element
+template <typename T>
+GapBuffer<T>::GapBuffer() = default;
+
+
+/// Creates buffer with [n] copies of [value]. The gap is at the end
+template <typename T>
+GapBuffer<T>::GapBuffer(unsigned n, const T &value) {
+    reserve(n);
+    std::uninitialized_fill_n(array, n, value);
+    gapStart = n;
+    stats.sized(n);
+}
+
+
+/// Creates buffer by array values. The gap is at the end
+template <typename T>
+GapBuffer<T>::GapBuffer(unsigned n, const T *values) {
+    reserve(n);
+    std::uninitialized_copy_n(values, n, array);
+    gapStart = n;
+    stats.sized(n);
+}
+
+
+/// Copy constructor. The copy gets exactly as much capacity as needed, the gap is at the end
+template <typename T>
+GapBuffer<T>::GapBuffer(const GapBuffer &other) {
+    unsigned n = other.getSize();
+    reserve(n);
+    std::uninitialized_copy_n(other.array, other.gapStart, array);
+    std::uninitialized_copy(other.array + other.gapEnd, other.array + other.capacity, array + other.gapStart);
+    gapStart = n;
+    stats.sized(n);
+}
+
+
+/// Move constructor. Storage is taken from the other buffer, which becomes empty
+template <typename T>
+GapBuffer<T>::GapBuffer(GapBuffer &&other) noexcept
+    : array(std::exchange(other.array, nullptr)), capacity(std::exchange(other.capacity, 0)),
+      gapStart(std::exchange(other.gapStart, 0)), gapEnd(std::exchange(other.gapEnd, 0)),
+      stats(std::exchange(other.stats, {})) {}
+
+
+/// Destructor
+template <typename T>
+GapBuffer<T>::~GapBuffer() {
+    destroy();
+}
+
+
+/// Assignment operator
+template <typename T>
+GapBuffer<T>& GapBuffer<T>::operator= (const GapBuffer &rhs) {
+    // Self-assignment handler
+    if (this == &rhs) return *this;
+
+    return *this = GapBuffer(rhs);
+}
+
+
+/// Move assignment operator. Storage is taken from rhs, which becomes empty
+template <typename T>
+GapBuffer<T>& GapBuffer<T>::operator= (GapBuffer &&rhs) noexcept {
+    // Self-assignment handler
+    if (this == &rhs) return *this;
+
+    destroy();
+    array = std::exchange(rhs.array, nullptr);
+    capacity = std::exchange(rhs.capacity, 0);
+    gapStart = std::exchange(rhs.gapStart, 0);
+    gapEnd = std::exchange(rhs.gapEnd, 0);
+    stats += std::exchange(rhs.stats, {});
+
+    return *this;
+}
+
+
+/// Print the buffer
+template <typename T>
+std::ostream& operator<< (std::ostream& os, const GapBuffer<T>& buffer) {
+    for (unsigned i = 0; i < buffer.getSize(); ++i)
+        os << *buffer.get(int(i)) << ' ';
+    return os;
+}
+
+
+/// Get element by it`s index via [] operator
+template <typename T>
+T * GapBuffer<T>::operator[] (int index) {
+    return get(index);
+}
+
+
+/// Get element by it`s index. Negative index counts from the end
+template <typename T>
+T * GapBuffer<T>::get(int index) {
+    return const_cast<T*>(std::as_const(*this).get(index));
+}
+
+
+/// Const version of get()
+template <typename T>
+const T * GapBuffer<T>::get(int index) const {
+    if (isEmpty()) {
+        std::cout << "IndexError: The array is empty\n";
+        return nullptr;
+    } else if (index >= int(getSize()) || index < -int(getSize())) {
+        std::cout << "IndexError: Index out of range\n";
+        return nullptr;
+    } else if (index < 0) {
+        index = int(getSize()) + index;
+    }
+
+    return &array[slot(unsigned(index))];
+}
+
+
+/// Return index if element found else -1
+template <typename T>
+int GapBuffer<T>::find(const T &value) const {
+    for (unsigned i = 0; i < gapStart; ++i)
+        if (array[i] == value) return int(i);
+    for (unsigned i = gapEnd; i < capacity; ++i)
+        if (array[i] == value) return int(i - (gapEnd - gapStart));
+    return -1;
+}
+
+
+/// Remove all the elements. The storage is kept
+template <typename T>
+void GapBuffer<T>::clear() {
+    if (!array) return;
+    std::destroy_n(array, gapStart);
+    std::destroy(array + gapEnd, array + capacity);
+    gapStart = 0;
+    gapEnd = capacity;
+}
+
+
+/// Make sure that the buffer holds at least the given amount of elements without reallocation
+template <typename T>
+void GapBuffer<T>::reserve(unsigned newCapacity) {
+    if (newCapacity <= capacity) return;
+    relocate(newCapacity);
+}
+
+
+/// Add the element to the end of the buffer
+template <typename T>
+void GapBuffer<T>::append(const T &value) {
+    insert(getSize(), T(value));
+}
+
+
+/// Move the element to the end of the buffer
+template <typename T>
+void GapBuffer<T>::append(T &&value) {
+    insert(getSize(), std::move(value));
+}
+
+
+/// Insert copy of the element to the specified position
+template <typename T>
+void GapBuffer<T>::insert(unsigned index, const T &value) {
+    insert(index, T(value));
+}
+
+
+/// Move the element to the specified position. Index equal to the size appends
+template <typename T>
+void GapBuffer<T>::insert(unsigned index, T &&value) {
+    // Index out of range
+    if (index > getSize()) {
+        std::cout << "IndexError: Index out of range\n";
+        return;
+    }
+
+    // Gap is used up. Grow at least twice, so inserting is amortized O(1)
+    if (gapStart == gapEnd) relocate(std::max(capacity * 2, INITIAL_CAPACITY));
+    moveGap(index);
+
+    std::construct_at(array + gapStart, std::move(value));
+    gapStart++;
+    stats.sized(getSize());
+}
+
+
+/// Remove element by it`s index
+template <typename T>
+void GapBuffer<T>::remove(unsigned index) {
+    if (index >= getSize()) {
+        std::cout << "IndexError: Index out of range\n";
+        return;
+    }
+
+    // The element becomes the first one after the gap and joins it
+    moveGap(index);
+    std::destroy_at(array + gapEnd);
+    gapEnd++;
+}
+
+
+/// Return the amount of elements
+template <typename T>
+unsigned GapBuffer<T>::getSize() const {
+    return capacity - (gapEnd - gapStart);
+}
+
+
+/// Return the amount of elements the buffer holds without reallocation
+template <typename T>
+unsigned GapBuffer<T>::getCapacity() const {
+    return capacity;
+}
+
+
+/// Return the index the gap is at, i.e. the position of the last edit
+template <typename T>
+unsigned GapBuffer<T>::getGapPosition() const {
+    return gapStart;
+}
+
+
+/// Return true if the buffer has no elements
+template <typename T>
+bool GapBuffer<T>::isEmpty() const {
+    return getSize() == 0;
+}
+
+
+/// Return the counters of the buffer (empty unless ADS_STATS is defined)
+template <typename T>
+const Stats& GapBuffer<T>::getStats() const {
+    return stats;
+}
+
+
+/// Reset the counters of the buffer
+template <typename T>
+void GapBuffer<T>::resetStats() {
+    stats = {};
+}
+
+
+#endif //PRACTICE01_GAP_BUFFER_H
@@ -0,0 +1,122 @@
+#include "hazard_pointers.h"
+
+#include <algorithm>
+#include <utility>
+
+
+std::atomic<HazardPointers::Slot*> HazardPointers::_slots = nullptr;
+std::atomic<unsigned> HazardPointers::_slotCount = 0;
+std::mutex HazardPointers::_orphanMutex;
+std::vector<HazardPointers::Retired> HazardPointers::_orphans;
+std::atomic<bool> HazardPointers::_hasOrphans = false;
+
+
+/// Free what can be freed and leave the rest to the other threads
+HazardPointers::Local::~Local() {
+    if (cached) cached->isTaken.store(false, std::memory_order_release);
+    scan(retired);
+    if (retired.empty()) return;
+
+    std::lock_guard lock(_orphanMutex);
+    _orphans.insert(_orphans.end(), retired.begin(), retired.end());
+    _hasOrphans.store(true, std::memory_order_release);
+}
+
+
+/// State of the current thread
+HazardPointers::Local& HazardPointers::local() {
+    thread_local Local state;
+    return state;
+}
+
+
+/// Take the cached slot of the thread, a free slot of the finished guards or a new one
+HazardPointers::Slot* HazardPointers::acquire() {
+    Local &state = local();
+    if (state.cached) return std::exchange(state.cached, nullptr);
+
+    for (Slot *slot = _slots.load(std::memory_order_acquire); slot; slot = slot->next) {
+        bool isTaken = false;
+        if (!slot->isTaken.load(std::memory_order_relaxed) &&
+            slot->isTaken.compare_exchange_strong(isTaken, true, std::memory_order_acquire))
+            return slot;
+    }
+
+    auto *slot = new Slot;
+    slot->next = _slots.load(std::memory_order_relaxed);
+    while (!_slots.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed));
+    _slotCount.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+
+/// Clear the slot and keep it for the next guard of the thread, or give it back
+void HazardPointers::release(Slot *slot) {
+    slot->pointer.store(nullptr, std::memory_order_release);
+    Local &state = local();
+    if (!state.cached) state.cached = slot;
+    else slot->isTaken.store(false, std::memory_order_release);
+}
+
+
+/// Add the node to the retired list of the thread and scan the list if it's long enough
+void HazardPointers::retire(void *pointer, Deleter deleter) {
+    std::vector<Retired> &retired = local().retired;
+    retired.push_back({pointer, deleter});
+    if (retired.size() >= 2 * _slotCount.load(std::memory_order_relaxed) + 32) scan(retired);
+}
+
+
+/**
+ * Free the retired nodes that no slot protects, the protected ones stay in the list.
+ * The orphans of the finished threads are taken over first
+ * @param[in, out] retired - retired list of the thread
+ */
+void HazardPointers::scan(std::vector<Retired> &retired) {
+    if (_hasOrphans.load(std::memory_order_acquire)) {
+        std::lock_guard lock(_orphanMutex);
+        retired.insert(retired.end(), _orphans.begin(), _orphans.end());
+        _orphans.clear();
+        _hasOrphans.store(false, std::memory_order_relaxed);
+    }
+    if (retired.empty()) return;
+
+    std::vector<const void*> hazards;
+    for (Slot *slot = _slots.load(std::memory_order_acquire); slot; slot = slot->next)
+        if (const void *pointer = slot->pointer.load()) hazards.push_back(pointer);
+    std::sort(hazards.begin(), hazards.end());
+
+    auto freed = std::partition(retired.begin(), retired.end(), [&](const Retired &node) {
+        return std::binary_search(hazards.begin(), hazards.end(), node.pointer);
+    });
+    for (auto it = freed; it != retired.end(); ++it) it->deleter(it->pointer);
+    retired.erase(freed, retired.end());
+}
+
+
+/// Free the retired nodes of the current thread that aren't protected any more
+void HazardPointers::collect() {
+    scan(local().retired);
+}
+
+
+/// Return amount of the nodes retired by the current thread and not freed yet
+unsigned HazardPointers::getRetiredCount() {
+    return unsigned(local().retired.size());
+}
+
+
+/// Take a slot for the current thread
+HazardPointers::Guard::Guard() : _slot(acquire()) {}
+
+
+/// Give the slot back, the protected node may be freed
+HazardPointers::Guard::~Guard() {
+    release(_slot);
+}
+
+
+/// Stop protecting the node
+void HazardPointers::Guard::reset() {
+    _slot->pointer.store(nullptr, std::memory_order_release);
+}
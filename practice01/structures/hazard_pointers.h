@@ -0,0 +1,113 @@
+#ifndef PRACTICE01_HAZARD_POINTERS_H
+#define PRACTICE01_HAZARD_POINTERS_H
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+
+/**
+ * @class HazardPointers
+ * @brief Safe memory reclamation for the lock-free structures
+ * A thread publishes the address of a shared node in a hazard slot before it reads the node (Guard::protect()).
+ * A node removed from the structure is retired instead of deleted and a later scan frees it once no slot
+ * holds it's address. A protected node is never freed, so it's address can't be reused by another node
+ * while a thread still compares against it, which also rules out the ABA problem of compare-and-swap.
+ *
+ * Every thread keeps it's own retired list and scans it when it grows over twice the amount of slots,
+ * so a retire costs O(1) amortized. Nodes a finished thread couldn't free are adopted by the next scan
+ */
+class HazardPointers {
+private:
+    using Deleter = void (*)(void*);
+
+    /// Hazard slot of one guard. Own cache line, the slot is written on every protect()
+    struct alignas(64) Slot {
+        std::atomic<const void*> pointer = nullptr;
+        std::atomic<bool> isTaken = true;
+        Slot *next = nullptr;
+    };
+
+    struct Retired {
+        void *pointer;
+        Deleter deleter;
+    };
+
+    /// State of one thread
+    struct Local {
+        std::vector<Retired> retired;
+        Slot *cached = nullptr;  // Slot kept between the guards of the thread
+        ~Local();
+    };
+
+    static std::atomic<Slot*> _slots;           // Slots are never freed, only reused
+    static std::atomic<unsigned> _slotCount;
+    static std::mutex _orphanMutex;
+    static std::vector<Retired> _orphans;       // Retired by the finished threads
+    static std::atomic<bool> _hasOrphans;
+
+    static Local& local();
+    static Slot* acquire();
+    static void release(Slot*);
+    static void retire(void*, Deleter);
+    static void scan(std::vector<Retired>&);
+public:
+    /**
+     * @class Guard
+     * @brief Hazard slot of the current thread, protects one node at a time
+     */
+    class Guard {
+    private:
+        Slot *_slot;
+    public:
+        // Constructors and destructor
+        Guard();
+        Guard(const Guard&) = delete;
+        ~Guard();
+
+        // Operators
+        Guard& operator= (const Guard&) = delete;
+
+        // Methods
+        template <typename T>
+        T * protect(const std::atomic<T*>&);
+        void reset();
+    };
+
+    template <typename T>
+    static void retire(T*);
+    static void collect();
+    [[nodiscard]] static unsigned getRetiredCount();
+};
+
+
+/**
+ * Read the pointer and protect the node it points to. The pointer is read again after it's published,
+ * so the node was still reachable when the protection started and no scan can free it until reset()
+ * @param[in] source - shared pointer to the node
+ * @return the protected pointer, may be nullptr
+ */
+template <typename T>
+T * HazardPointers::Guard::protect(const std::atomic<T*> &source) {
+    T *pointer = source.load(std::memory_order_relaxed);
+    while (true) {
+        _slot->pointer.store(pointer);
+        T *current = source.load();
+        if (current == pointer) return pointer;
+        pointer = current;
+    }
+}
+
+
+/**
+ * Delete the node once no thread protects it. The node must be unreachable for the threads
+ * that haven't protected it yet
+ * @param[in] pointer - node allocated with new
+ */
+template <typename T>
+void HazardPointers::retire(T *pointer) {
+    retire(pointer, [](void *node) { delete static_cast<T*>(node); });
+}
+
+
+#endif //PRACTICE01_HAZARD_POINTERS_H
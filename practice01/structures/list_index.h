@@ -0,0 +1,309 @@
+#ifndef PRACTICE01_LIST_INDEX_H
+#define PRACTICE01_LIST_INDEX_H
+
+#include <vector>
+
+
+/**
+ * @class ListIndex
+ * @brief Indexable skip list over the nodes of a List
+ * The list itself is the bottom level. Every node gets a tower of height k with probability (1/4)^k,
+ * links of the towers store the distance in nodes. Search, insert and remove by position are O(log n),
+ * append is O(1) expected via the last towers of each level. Positions are counted as ranks (index + 1),
+ * the head sentinel has rank 0
+ * @tparam NodeT - type of the list node (has 'next' pointer)
+ */
+template <typename NodeT>
+class ListIndex {
+public:
+    static constexpr unsigned MAX_LEVEL = 16;
+
+private:
+    struct Tower;
+    struct Link {
+        Tower *next = nullptr;
+        unsigned width = 0;  // Distance to the next tower in nodes (0 if there is no next tower)
+    };
+    struct Tower {
+        NodeT *node = nullptr;
+        std::vector<Link> links;
+    };
+
+    Tower _head;                         // Sentinel before the first node
+    unsigned _level = 0;                 // Amount of levels in use
+    Tower *_last[MAX_LEVEL] = {};        // Last tower of each level
+    unsigned _lastRank[MAX_LEVEL] = {};  // Rank of the last tower of each level
+    unsigned _seed = 2463534242;         // State of the xorshift generator
+    bool _isStale = false;               // List was changed bypassing the index
+
+    unsigned randomHeight();
+    void addLevels(unsigned);
+    void search(unsigned, Tower**, unsigned*);
+public:
+    // Constructors and destructor
+    ListIndex();
+    ListIndex(const ListIndex&) = delete;
+    ~ListIndex();
+
+    // Operators
+    ListIndex& operator= (const ListIndex&) = delete;
+
+    // Methods
+    void clear();
+    void build(NodeT*, unsigned);
+    NodeT * get(NodeT*, unsigned) const;
+    void appended(NodeT*, unsigned);
+    void inserted(NodeT*, unsigned);
+    void removed(unsigned);
+    void replaced(unsigned, NodeT*);
+    void invalidate();
+    [[nodiscard]] bool isStale() const;
+};
+
+
+/// Default constructor. Empty index, the head sentinel has links on all the levels
+template <typename NodeT>
+ListIndex<NodeT>::ListIndex() {
+    _head.links.resize(MAX_LEVEL);
+}
+
+
+/// Free the towers
+template <typename NodeT>
+ListIndex<NodeT>::~ListIndex() {
+    clear();
+}
+
+
+/// Height of the new tower. Zero with probability 3/4, each next level is 4 times less likely
+template <typename NodeT>
+unsigned ListIndex<NodeT>::randomHeight() {
+    unsigned height = 0;
+    while (height < MAX_LEVEL) {
+        // xorshift32
+        _seed ^= _seed << 13;
+        _seed ^= _seed >> 17;
+        _seed ^= _seed << 5;
+        if (_seed & 3) break;
+        height++;
+    }
+    return height;
+}
+
+
+/// Make sure that the levels [0, height) are in use
+template <typename NodeT>
+void ListIndex<NodeT>::addLevels(unsigned height) {
+    for (; _level < height; ++_level) {
+        _head.links[_level] = Link();
+        _last[_level] = &_head;
+        _lastRank[_level] = 0;
+    }
+}
+
+
+/**
+ * Find the last tower with the rank less than the target on each level in use
+ * @param[in] target - rank to search for
+ * @param[out] update - found towers
+ * @param[out] rank - ranks of the found towers
+ */
+template <typename NodeT>
+void ListIndex<NodeT>::search(unsigned target, Tower **update, unsigned *rank) {
+    Tower *tower = &_head;
+    unsigned current = 0;
+    for (unsigned level = _level; level-- > 0;) {
+        while (tower->links[level].next && current + tower->links[level].width < target) {
+            current += tower->links[level].width;
+            tower = tower->links[level].next;
+        }
+        update[level] = tower;
+        rank[level] = current;
+    }
+}
+
+
+/// Remove all the towers
+template <typename NodeT>
+void ListIndex<NodeT>::clear() {
+    Tower *tower = _level ? _head.links[0].next : nullptr;
+    while (tower) {
+        Tower *temp = tower;
+        tower = tower->links[0].next;
+        delete temp;
+    }
+    _level = 0;
+    _isStale = false;
+}
+
+
+/**
+ * Rebuild the index from scratch in O(n)
+ * @param[in] head - first node of the list
+ * @param[in] size - amount of nodes in the list
+ */
+template <typename NodeT>
+void ListIndex<NodeT>::build(NodeT *head, unsigned size) {
+    clear();
+    NodeT *node = head;
+    for (unsigned i = 0; i < size; ++i, node = node->next)
+        appended(node, i);
+}
+
+
+/**
+ * Get node by it's index. Towers bring the search to the closest preceding node, the rest is walked
+ * @param[in] head - first node of the list
+ * @param[in] index - index of the node (index < size)
+ * @return found node
+ */
+template <typename NodeT>
+NodeT * ListIndex<NodeT>::get(NodeT *head, unsigned index) const {
+    const Tower *tower = &_head;
+    unsigned rank = 0;
+    for (unsigned level = _level; level-- > 0;) {
+        while (tower->links[level].next && rank + tower->links[level].width <= index + 1) {
+            rank += tower->links[level].width;
+            tower = tower->links[level].next;
+        }
+    }
+
+    // Walk the rest by the list itself
+    NodeT *node = tower == &_head ? head : tower->node;
+    for (unsigned i = tower == &_head ? 1 : rank; i < index + 1; ++i)
+        node = node->next;
+    return node;
+}
+
+
+/**
+ * Register the node appended to the list in O(1) expected
+ * @param[in] node - appended node
+ * @param[in] index - index of the node (size - 1)
+ */
+template <typename NodeT>
+void ListIndex<NodeT>::appended(NodeT *node, unsigned index) {
+    unsigned height = randomHeight();
+    if (height == 0) return;
+    addLevels(height);
+
+    auto *tower = new Tower{node, std::vector<Link>(height)};
+    for (unsigned level = 0; level < height; ++level) {
+        _last[level]->links[level] = {tower, index + 1 - _lastRank[level]};
+        _last[level] = tower;
+        _lastRank[level] = index + 1;
+    }
+}
+
+
+/**
+ * Register the node inserted to the list in O(log n). Nodes after it are shifted by one
+ * @param[in] node - inserted node
+ * @param[in] index - index of the node
+ */
+template <typename NodeT>
+void ListIndex<NodeT>::inserted(NodeT *node, unsigned index) {
+    Tower *update[MAX_LEVEL];
+    unsigned rank[MAX_LEVEL];
+    unsigned height = randomHeight();
+    addLevels(height);
+    search(index + 1, update, rank);
+
+    Tower *tower = height ? new Tower{node, std::vector<Link>(height)} : nullptr;
+    for (unsigned level = 0; level < _level; ++level) {
+        Link &link = update[level]->links[level];
+        bool isLastAfter = _last[level] != update[level];
+
+        if (level < height) {
+            // Link the new tower between the found one and it's next
+            tower->links[level].next = link.next;
+            tower->links[level].width = link.next ? rank[level] + link.width - index : 0;
+            link = {tower, index + 1 - rank[level]};
+            if (isLastAfter) {
+                _lastRank[level]++;
+            } else {
+                _last[level] = tower;
+                _lastRank[level] = index + 1;
+            }
+        } else {
+            // Link jumps over the new node
+            if (link.next) link.width++;
+            if (isLastAfter) _lastRank[level]++;
+        }
+    }
+}
+
+
+/**
+ * Unregister the node that is going to be removed from the list in O(log n). Nodes after it are shifted by one
+ * @param[in] index - index of the node
+ */
+template <typename NodeT>
+void ListIndex<NodeT>::removed(unsigned index) {
+    if (_level == 0) return;
+
+    Tower *update[MAX_LEVEL];
+    unsigned rank[MAX_LEVEL];
+    search(index + 1, update, rank);
+
+    // Does the node have a tower
+    Tower *target = update[0]->links[0].next;
+    if (target && rank[0] + update[0]->links[0].width != index + 1) target = nullptr;
+    unsigned height = target ? target->links.size() : 0;
+
+    for (unsigned level = 0; level < _level; ++level) {
+        Link &link = update[level]->links[level];
+
+        if (level < height) {
+            // Unlink the tower
+            Link &next = target->links[level];
+            link.width = next.next ? link.width + next.width - 1 : 0;
+            link.next = next.next;
+            if (_last[level] == target) {
+                _last[level] = update[level];
+                _lastRank[level] = rank[level];
+            } else {
+                _lastRank[level]--;
+            }
+        } else {
+            // Link jumps over the removed node
+            if (link.next) link.width--;
+            if (_last[level] != update[level]) _lastRank[level]--;
+        }
+    }
+    delete target;
+
+    // Drop the empty levels
+    while (_level > 0 && !_head.links[_level - 1].next) _level--;
+}
+
+
+/// Point the tower of the index-th node (if there is one) to another node. Used after nodes are swapped
+template <typename NodeT>
+void ListIndex<NodeT>::replaced(unsigned index, NodeT *node) {
+    if (_level == 0) return;
+
+    Tower *update[MAX_LEVEL];
+    unsigned rank[MAX_LEVEL];
+    search(index + 1, update, rank);
+
+    Link &link = update[0]->links[0];
+    if (link.next && rank[0] + link.width == index + 1) link.next->node = node;
+}
+
+
+/// Mark the index as outdated. It is rebuilt on the next access
+template <typename NodeT>
+void ListIndex<NodeT>::invalidate() {
+    _isStale = true;
+}
+
+
+/// Return true if the index must be rebuilt before use
+template <typename NodeT>
+bool ListIndex<NodeT>::isStale() const {
+    return _isStale;
+}
+
+
+#endif //PRACTICE01_LIST_INDEX_H
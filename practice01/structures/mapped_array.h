@@ -0,0 +1,468 @@
+#ifndef PRACTICE01_MAPPED_ARRAY_H
+#define PRACTICE01_MAPPED_ARRAY_H
+
+// Memory mapping is implemented for POSIX systems only
+#if defined(__unix__) || defined(__APPLE__)
+#define MAPPED_DARRAY_SUPPORTED
+
+#include "stats.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <iostream>
+
+
+/**
+ * @class MappedDArray
+ * @brief Dynamic array stored in a memory-mapped file
+ * The elements live in the file, the OS pages them in and out, so the array may be larger than RAM.
+ * The file grows geometrically on append() and resize(). Reopening a file maps it without reading,
+ * the data is usable at once and only the touched pages are loaded.
+ *
+ * File layout: 64-byte header (magic, element size, amount of elements), then the elements.
+ * Growing remaps the file, so pointers to the elements are invalidated like in DArray.
+ * The file is trimmed to the elements on close(). Errors are printed, methods return false
+ * @tparam T - type of the values, trivially copyable (stored as raw bytes)
+ */
+template <typename T>
+class MappedDArray {
+    static_assert(std::is_trivially_copyable_v<T>, "MappedDArray stores elements as raw bytes");
+
+public:
+    /// Expected access pattern of the elements, passed to madvise()
+    enum class Access { Normal, Sequential, Random, WillNeed, DontNeed };
+
+    static constexpr std::size_t INITIAL_CAPACITY = 1024;
+
+private:
+    struct alignas(64) Header {
+        char magic[8];
+        std::uint64_t elementSize;
+        std::uint64_t size;
+    };
+    static constexpr char MAGIC[8] = {'A', 'D', 'S', 'D', 'A', 'R', 'R', '1'};
+
+    int fd = -1;
+    Header * header = nullptr;  // Start of the mapping
+    T * array = nullptr;        // Elements right after the header
+    std::size_t capacity = 0;   // Amount of the elements that fit the file
+    [[no_unique_address]] Stats stats;
+
+    static std::size_t fileSize(std::size_t);
+    bool map(std::size_t);
+    void unmap();
+    bool grow(std::size_t);
+    static bool fail(const char*);
+public:
+    // Constructors and destructor
+    MappedDArray();
+    explicit MappedDArray(const std::string&);
+    MappedDArray(const MappedDArray&) = delete;
+    MappedDArray(MappedDArray&&) noexcept;
+    ~MappedDArray();
+
+    // Operators
+    MappedDArray& operator= (const MappedDArray&) = delete;
+    MappedDArray& operator= (MappedDArray&&) noexcept;
+    T * operator[] (std::size_t);
+    const T * operator[] (std::size_t) const;
+
+    // Iterators
+    T * begin();
+    T * end();
+    const T * begin() const;
+    const T * end() const;
+
+    // Methods
+    bool open(const std::string&);
+    void close();
+    bool sync(bool = false);
+    bool advise(Access, std::size_t = 0, std::size_t = SIZE_MAX);
+    T * get(std::size_t);
+    bool append(const T&);
+    bool reserve(std::size_t);
+    bool resize(std::size_t);
+    void clear();
+    T * data();
+    [[nodiscard]] std::size_t getSize() const;
+    [[nodiscard]] std::size_t getCapacity() const;
+    [[nodiscard]] bool isEmpty() const;
+    [[nodiscard]] bool isOpen() const;
+    [[nodiscard]] const Stats& getStats() const;
+    void resetStats();
+};
+
+
+/// Size of the file that holds the header and [count] elements
+template <typename T>
+std::size_t MappedDArray<T>::fileSize(std::size_t count) {
+    return sizeof(Header) + count * sizeof(T);
+}
+
+
+/**
+ * Resize the file to [newCapacity] elements and map it. The current mapping is replaced only
+ * after the new one is made, so on failure the array stays usable (a grown file is trimmed on close())
+ * @param[in] newCapacity - amount of the elements the file must hold
+ * @return true if the file is mapped
+ */
+template <typename T>
+bool MappedDArray<T>::map(std::size_t newCapacity) {
+    if (ftruncate(fd, off_t(fileSize(newCapacity))) != 0) return fail("Can't resize the file");
+
+    void *base = mmap(nullptr, fileSize(newCapacity), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) return fail("Can't map the file");
+
+    // Both mappings share the pages of the file, nothing is copied
+    unmap();
+    header = static_cast<Header*>(base);
+    array = reinterpret_cast<T*>(header + 1);
+    capacity = newCapacity;
+    return true;
+}
+
+
+/// Unmap the file. Dirty pages are still written back by the OS
+template <typename T>
+void MappedDArray<T>::unmap() {
+    if (header) munmap(header, fileSize(capacity));
+    header = nullptr;
+    array = nullptr;
+}
+
+
+/**
+ * Grow the file to hold at least [required] elements. Grows at least twice, so appending is amortized O(1)
+ * @param[in] required - amount of the elements
+ * @return true if the file is large enough
+ */
+template <typename T>
+bool MappedDArray<T>::grow(std::size_t required) {
+    if (required <= capacity) return true;
+    if (!reserve(std::max({required, capacity * 2, INITIAL_CAPACITY}))) return false;
+    stats.reallocated();
+    return true;
+}
+
+
+/// Print the error and return false
+template <typename T>
+bool MappedDArray<T>::fail(const char *message) {
+    std::cout << "IOError: " << message << '\n';
+    return false;
+}
+
+
+/// Default constructor. The array isn't bound to a file until open()
+template <typename T>
+MappedDArray<T>::MappedDArray() = default;
+
+
+/// Open or create the array in the file
+template <typename T>
+MappedDArray<T>::MappedDArray(const std::string &path) {
+    open(path);
+}
+
+
+/// Move constructor. The other array is closed
+template <typename T>
+MappedDArray<T>::MappedDArray(MappedDArray &&other) noexcept
+    : fd(std::exchange(other.fd, -1)), header(std::exchange(other.header, nullptr)),
+      array(std::exchange(other.array, nullptr)), capacity(std::exchange(other.capacity, 0)),
+      stats(std::exchange(other.stats, {})) {}
+
+
+/// Destructor. Closes the file
+template <typename T>
+MappedDArray<T>::~MappedDArray() {
+    close();
+}
+
+
+/// Move assignment operator. This array is closed, rhs is moved and closed
+template <typename T>
+MappedDArray<T>& MappedDArray<T>::operator= (MappedDArray &&rhs) noexcept {
+    // Self-assignment handler
+    if (this == &rhs) return *this;
+
+    close();
+    fd = std::exchange(rhs.fd, -1);
+    header = std::exchange(rhs.header, nullptr);
+    array = std::exchange(rhs.array, nullptr);
+    capacity = std::exchange(rhs.capacity, 0);
+    stats += std::exchange(rhs.stats, {});
+
+    return *this;
+}
+
+
+/// Operator [] overloading. Same as get()
+template <typename T>
+T * MappedDArray<T>::operator[] (std::size_t index) {
+    return get(index);
+}
+
+
+/// Const version of the operator []
+template <typename T>
+const T * MappedDArray<T>::operator[] (std::size_t index) const {
+    return const_cast<MappedDArray*>(this)->get(index);
+}
+
+
+/// Pointer to the first element
+template <typename T>
+T * MappedDArray<T>::begin() {
+    return array;
+}
+
+
+/// Pointer past the last element
+template <typename T>
+T * MappedDArray<T>::end() {
+    return array + getSize();
+}
+
+
+/// Const pointer to the first element
+template <typename T>
+const T * MappedDArray<T>::begin() const {
+    return array;
+}
+
+
+/// Const pointer past the last element
+template <typename T>
+const T * MappedDArray<T>::end() const {
+    return array + getSize();
+}
+
+
+/**
+ * Map the file, creating it if doesn't exist. Existing elements aren't read, the pages are loaded on access
+ * @param[in] path - path to the file
+ * @return true if the array is open
+ */
+template <typename T>
+bool MappedDArray<T>::open(const std::string &path) {
+    close();
+
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) return fail("Can't open the file");
+
+    struct stat info{};
+    if (fstat(fd, &info) != 0) {
+        close();
+        return fail("Can't read the file size");
+    }
+
+    // New file, write the header
+    if (info.st_size == 0) {
+        if (!map(0)) {
+            close();
+            return false;
+        }
+        std::memcpy(header->magic, MAGIC, sizeof(MAGIC));
+        header->elementSize = sizeof(T);
+        header->size = 0;
+        return true;
+    }
+
+    // Existing file, check the header
+    if (std::size_t(info.st_size) < sizeof(Header)) {
+        close();
+        return fail("The file isn't an array");
+    }
+    if (!map((std::size_t(info.st_size) - sizeof(Header)) / sizeof(T))) {
+        close();
+        return false;
+    }
+    if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || header->elementSize != sizeof(T)) {
+        close();
+        return fail("The file isn't an array of this type");
+    }
+    if (header->size > capacity) {
+        close();
+        return fail("The file is truncated");
+    }
+
+    return true;
+}
+
+
+/// Trim the file to the elements, unmap and close it. Nothing happens if the array isn't open
+template <typename T>
+void MappedDArray<T>::close() {
+    if (header) {
+        std::size_t size = getSize();
+        unmap();
+        if (ftruncate(fd, off_t(fileSize(size))) != 0) fail("Can't trim the file");
+    }
+    if (fd >= 0) ::close(fd);
+    fd = -1;
+    capacity = 0;
+}
+
+
+/**
+ * Write the changed pages to the file (msync)
+ * @param[in] isAsync - schedule the write and return at once
+ * @return true if succeeded
+ */
+template <typename T>
+bool MappedDArray<T>::sync(bool isAsync) {
+    if (!isOpen()) return fail("The array isn't open");
+    if (msync(header, fileSize(capacity), isAsync ? MS_ASYNC : MS_SYNC) != 0) return fail("Can't sync the file");
+    return true;
+}
+
+
+/**
+ * Tell the OS how the elements will be accessed (madvise)
+ * @param[in] access - expected access pattern
+ * @param[in] from - index of the first element (def. = 0)
+ * @param[in] count - amount of the elements (def. = all up to the end)
+ * @return true if succeeded
+ */
+template <typename T>
+bool MappedDArray<T>::advise(Access access, std::size_t from, std::size_t count) {
+    if (!isOpen()) return fail("The array isn't open");
+    if (from >= capacity) return true;
+    count = std::min(count, capacity - from);
+
+    // madvise() takes the page-aligned range
+    static const std::uintptr_t pageSize = sysconf(_SC_PAGESIZE);
+    auto first = reinterpret_cast<std::uintptr_t>(array + from) & ~(pageSize - 1);
+    auto last = reinterpret_cast<std::uintptr_t>(array + from + count);
+
+    int advice = MADV_NORMAL;
+    switch (access) {
+        case Access::Normal: advice = MADV_NORMAL; break;
+        case Access::Sequential: advice = MADV_SEQUENTIAL; break;
+        case Access::Random: advice = MADV_RANDOM; break;
+        case Access::WillNeed: advice = MADV_WILLNEED; break;
+        case Access::DontNeed: advice = MADV_DONTNEED; break;
+    }
+    if (madvise(reinterpret_cast<void*>(first), last - first, advice) != 0) return fail("Can't advise the access");
+    return true;
+}
+
+
+/// Get pointer to the element by index. Prints an error and returns nullptr if out of range
+template <typename T>
+T * MappedDArray<T>::get(std::size_t index) {
+    if (index >= getSize()) {
+        std::cout << "IndexError: Index out of range\n";
+        return nullptr;
+    }
+    return array + index;
+}
+
+
+/// Add the element to the end of the array, growing the file if needed
+template <typename T>
+bool MappedDArray<T>::append(const T &value) {
+    if (!isOpen()) return fail("The array isn't open");
+    std::size_t size = getSize();
+    if (!grow(size + 1)) return false;
+
+    array[size] = value;
+    header->size = size + 1;
+    stats.sized(size + 1);
+    return true;
+}
+
+
+/// Make sure that the file holds at least the given amount of elements without remapping
+template <typename T>
+bool MappedDArray<T>::reserve(std::size_t newCapacity) {
+    if (newCapacity <= capacity) return true;
+    if (!isOpen()) return fail("The array isn't open");
+
+    std::size_t oldCapacity = capacity;
+    if (!map(newCapacity)) return false;
+    stats.allocated((newCapacity - oldCapacity) * sizeof(T));
+    return true;
+}
+
+
+/// Change the amount of the elements. New elements are value-initialized, the file grows geometrically
+template <typename T>
+bool MappedDArray<T>::resize(std::size_t newSize) {
+    if (!isOpen()) return fail("The array isn't open");
+    std::size_t size = getSize();
+    if (!grow(newSize)) return false;
+
+    if (newSize > size) std::fill(array + size, array + newSize, T());
+    header->size = newSize;
+    stats.sized(newSize);
+    return true;
+}
+
+
+/// Remove all the elements. The file keeps it's size until close()
+template <typename T>
+void MappedDArray<T>::clear() {
+    if (header) header->size = 0;
+}
+
+
+/// Pointer to the mapped elements
+template <typename T>
+T * MappedDArray<T>::data() {
+    return array;
+}
+
+
+/// Return the amount of the elements
+template <typename T>
+std::size_t MappedDArray<T>::getSize() const {
+    return header ? header->size : 0;
+}
+
+
+/// Return the amount of the elements that fit the file
+template <typename T>
+std::size_t MappedDArray<T>::getCapacity() const {
+    return capacity;
+}
+
+
+/// Return true if there are no elements
+template <typename T>
+bool MappedDArray<T>::isEmpty() const {
+    return getSize() == 0;
+}
+
+
+/// Return true if the array is bound to a file
+template <typename T>
+bool MappedDArray<T>::isOpen() const {
+    return header != nullptr;
+}
+
+
+/// Return the counters of the array (empty unless ADS_STATS is defined)
+template <typename T>
+const Stats& MappedDArray<T>::getStats() const {
+    return stats;
+}
+
+
+/// Reset the counters of the array
+template <typename T>
+void MappedDArray<T>::resetStats() {
+    stats = {};
+}
+
+
+#endif //MAPPED_DARRAY_SUPPORTED
+#endif //PRACTICE01_MAPPED_ARRAY_H
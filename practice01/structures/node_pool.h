@@ -0,0 +1,165 @@
+#ifndef PRACTICE01_NODE_POOL_H
+#define PRACTICE01_NODE_POOL_H
+
+#include <memory>
+
+
+/**
+ * @class NodePool
+ * @brief Slab allocator for the list nodes
+ * Nodes are carved out of blocks of BLOCK_SIZE nodes, freed nodes are kept in a free list
+ * and reused, all the blocks are returned to the allocator at once by release().
+ * Runs of consecutive nodes may be requested at once, a run longer than a block gets the own block.
+ * The pool hands out raw storage, nodes are constructed and destroyed by the owner
+ * @tparam NodeT - type of the node
+ * @tparam Allocator - allocator the blocks are taken from
+ */
+template <typename NodeT, typename Allocator = std::allocator<NodeT>>
+class NodePool {
+public:
+    static constexpr unsigned BLOCK_SIZE = 256;
+
+private:
+    /// Storage of one node. Free slots are linked into the free list
+    union Slot {
+        Slot *next;
+        alignas(NodeT) unsigned char storage[sizeof(NodeT)];
+    };
+    static_assert(sizeof(Slot) == sizeof(NodeT), "Slots of a run must be laid out as an array of nodes");
+
+    /// Block of slots. Blocks are chained so that they can be released at once
+    struct Block {
+        Block *next = nullptr;
+        Slot *slots = nullptr;
+        unsigned capacity = 0;
+    };
+
+    using BlockAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Block>;
+    using BlockTraits = std::allocator_traits<BlockAllocator>;
+    using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+    using SlotTraits = std::allocator_traits<SlotAllocator>;
+
+    [[no_unique_address]] BlockAllocator _alloc;
+    [[no_unique_address]] SlotAllocator _slotAlloc;
+    Block *_blocks = nullptr;  // Chain of allocated blocks, the one being carved first
+    Slot *_free = nullptr;     // Free list
+    unsigned _used = 0;        // Amount of slots taken from the first block
+
+    Block * createBlock(unsigned);
+public:
+    // Constructors and destructor
+    explicit NodePool(const Allocator &alloc = Allocator());
+    NodePool(const NodePool&) = delete;
+    ~NodePool();
+
+    // Operators
+    NodePool& operator= (const NodePool&) = delete;
+
+    // Methods
+    NodeT * allocate();
+    NodeT * allocate(unsigned);
+    void deallocate(NodeT*);
+    void release();
+};
+
+
+/// Constructor. No blocks are allocated until the first node is requested
+template <typename NodeT, typename Allocator>
+NodePool<NodeT, Allocator>::NodePool(const Allocator &alloc) : _alloc(alloc), _slotAlloc(alloc) {}
+
+
+/// Return all the blocks to the allocator
+template <typename NodeT, typename Allocator>
+NodePool<NodeT, Allocator>::~NodePool() {
+    release();
+}
+
+
+/// Allocate a block of the given amount of slots. Block is not chained
+template <typename NodeT, typename Allocator>
+typename NodePool<NodeT, Allocator>::Block * NodePool<NodeT, Allocator>::createBlock(unsigned capacity) {
+    Block *block = BlockTraits::allocate(_alloc, 1);
+    BlockTraits::construct(_alloc, block);
+    block->slots = SlotTraits::allocate(_slotAlloc, capacity);
+    block->capacity = capacity;
+    return block;
+}
+
+
+/// Get storage for a node from the free list or from the first block. Allocate a new block if both are exhausted
+template <typename NodeT, typename Allocator>
+NodeT * NodePool<NodeT, Allocator>::allocate() {
+    // Reuse the freed slot
+    if (_free) {
+        Slot *slot = _free;
+        _free = _free->next;
+        return reinterpret_cast<NodeT*>(slot->storage);
+    }
+
+    return allocate(1);
+}
+
+
+/**
+ * Get storage for the run of consecutive nodes. Free list is not used, so the run is contiguous
+ * @param[in] count - amount of nodes (count > 0)
+ * @return pointer to the first node of the run. Nodes of the run may be deallocated one by one
+ */
+template <typename NodeT, typename Allocator>
+NodeT * NodePool<NodeT, Allocator>::allocate(unsigned count) {
+    // Long run. Give it the own block and keep carving the current one
+    if (count > BLOCK_SIZE) {
+        Block *block = createBlock(count);
+        if (_blocks) {
+            block->next = _blocks->next;
+            _blocks->next = block;
+        } else {
+            _blocks = block;
+            _used = count;
+        }
+        return reinterpret_cast<NodeT*>(block->slots[0].storage);
+    }
+
+    // The rest of the first block is too short. Put it to the free list and add a new block
+    if (!_blocks || _blocks->capacity - _used < count) {
+        for (; _blocks && _used < _blocks->capacity; ++_used) {
+            _blocks->slots[_used].next = _free;
+            _free = &_blocks->slots[_used];
+        }
+        Block *block = createBlock(BLOCK_SIZE);
+        block->next = _blocks;
+        _blocks = block;
+        _used = 0;
+    }
+
+    Slot *run = &_blocks->slots[_used];
+    _used += count;
+    return reinterpret_cast<NodeT*>(run->storage);
+}
+
+
+/// Return storage of a destroyed node to the free list. Memory stays in the pool until release()
+template <typename NodeT, typename Allocator>
+void NodePool<NodeT, Allocator>::deallocate(NodeT *node) {
+    auto *slot = reinterpret_cast<Slot*>(node);
+    slot->next = _free;
+    _free = slot;
+}
+
+
+/// Free all the blocks. Storage of every node taken from the pool becomes invalid
+template <typename NodeT, typename Allocator>
+void NodePool<NodeT, Allocator>::release() {
+    while (_blocks) {
+        Block *temp = _blocks;
+        _blocks = _blocks->next;
+        SlotTraits::deallocate(_slotAlloc, temp->slots, temp->capacity);
+        BlockTraits::destroy(_alloc, temp);
+        BlockTraits::deallocate(_alloc, temp, 1);
+    }
+    _free = nullptr;
+    _used = 0;
+}
+
+
+#endif //PRACTICE01_NODE_POOL_H
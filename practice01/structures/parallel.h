@@ -0,0 +1,220 @@
+#ifndef PRACTICE01_PARALLEL_H
+#define PRACTICE01_PARALLEL_H
+
+#include "dynamic_array.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <utility>
+
+
+/**
+ * @class Parallel
+ * @brief Data-parallel bulk algorithms over DArray
+ * The array is split into chunks of CHUNK_BYTES that fit the L2 cache and the chunks are run on the
+ * pool threads. Arrays of one chunk run on the calling thread without waking the pool.
+ * Reductions and scans combine the chunks in order, so the operation only has to be associative
+ */
+class Parallel {
+public:
+    static constexpr unsigned CHUNK_BYTES = 256 * 1024;
+
+private:
+    /// Amount of elements in one chunk
+    template <typename T>
+    static unsigned chunkSize() {
+        return std::max(unsigned(CHUNK_BYTES / sizeof(T)), 1u);
+    }
+
+    /// Amount of chunks of the array
+    template <typename T>
+    static unsigned chunkCount(unsigned size) {
+        return (size + chunkSize<T>() - 1) / chunkSize<T>();
+    }
+
+    /**
+     * Call func(index, begin, end) for every chunk of [0, size), in parallel if there are several chunks
+     * @param[in] size - amount of elements
+     * @param[in] pool - threads to run on
+     * @param[in] func - callable that takes the number of the chunk and it's bounds
+     */
+    template <typename T, typename Func>
+    static void forChunks(unsigned size, ThreadPool &pool, Func &&func) {
+        unsigned chunk = chunkSize<T>();
+        unsigned count = chunkCount<T>(size);
+        auto task = [&](unsigned index) {
+            unsigned begin = index * chunk;
+            func(index, begin, std::min(begin + chunk, size));
+        };
+        if (count <= 1 || pool.getThreadCount() == 1) for (unsigned i = 0; i < count; ++i) task(i);
+        else pool.run(count, task);
+    }
+
+public:
+    template <typename T, unsigned N>
+    static void fill(DArray<T, N>&, const T&, ThreadPool& = ThreadPool::shared());
+    template <typename T, unsigned N, typename Func>
+    static void transform(DArray<T, N>&, Func, ThreadPool& = ThreadPool::shared());
+    template <typename T, unsigned N, typename Op = std::plus<>>
+    static T reduce(const DArray<T, N>&, T, Op = {}, ThreadPool& = ThreadPool::shared());
+    template <typename T, unsigned N, typename Op = std::plus<>>
+    static void inclusive_scan(DArray<T, N>&, Op = {}, ThreadPool& = ThreadPool::shared());
+    template <typename T, unsigned N, typename Pred>
+    static unsigned count_if(const DArray<T, N>&, Pred, ThreadPool& = ThreadPool::shared());
+    template <typename T, unsigned N, typename Pred>
+    static unsigned partition(DArray<T, N>&, Pred, ThreadPool& = ThreadPool::shared());
+};
+
+
+/**
+ * Assign the value to every element
+ * @param[in] arr - array to fill
+ * @param[in] value - value to assign
+ * @param[in] pool - threads to run on (def. = all cores)
+ */
+template <typename T, unsigned N>
+void Parallel::fill(DArray<T, N> &arr, const T &value, ThreadPool &pool) {
+    T *data = arr.data();
+    forChunks<T>(arr.getSize(), pool, [&](unsigned, unsigned begin, unsigned end) {
+        std::fill(data + begin, data + end, value);
+    });
+}
+
+
+/**
+ * Replace every element with func(element)
+ * @param[in] arr - array to transform
+ * @param[in] func - callable, called concurrently
+ * @param[in] pool - threads to run on (def. = all cores)
+ */
+template <typename T, unsigned N, typename Func>
+void Parallel::transform(DArray<T, N> &arr, Func func, ThreadPool &pool) {
+    T *data = arr.data();
+    forChunks<T>(arr.getSize(), pool, [&](unsigned, unsigned begin, unsigned end) {
+        std::transform(data + begin, data + end, data + begin, func);
+    });
+}
+
+
+/**
+ * Combine the elements with the operation. Chunks are reduced in parallel and combined in order
+ * @param[in] arr - array to reduce
+ * @param[in] init - initial value, combined before the first element
+ * @param[in] op - associative operation (def. = +)
+ * @param[in] pool - threads to run on (def. = all cores)
+ * @return init op arr[0] op ... op arr[n-1]
+ */
+template <typename T, unsigned N, typename Op>
+T Parallel::reduce(const DArray<T, N> &arr, T init, Op op, ThreadPool &pool) {
+    if (arr.isEmpty()) return init;
+
+    const T *data = arr.data();
+    DArray<T> partials(chunkCount<T>(arr.getSize()));
+    forChunks<T>(arr.getSize(), pool, [&](unsigned index, unsigned begin, unsigned end) {
+        *partials[int(index)] = std::accumulate(data + begin + 1, data + end, data[begin], op);
+    });
+
+    for (const T &partial : partials) init = op(std::move(init), partial);
+    return init;
+}
+
+
+/**
+ * Replace every element with the combination of it and all the previous ones. Each chunk is reduced,
+ * the totals are scanned serially and each chunk is scanned starting from the total of the previous ones
+ * @param[in] arr - array to scan
+ * @param[in] op - associative operation (def. = +)
+ * @param[in] pool - threads to run on (def. = all cores)
+ */
+template <typename T, unsigned N, typename Op>
+void Parallel::inclusive_scan(DArray<T, N> &arr, Op op, ThreadPool &pool) {
+    if (arr.isEmpty()) return;
+
+    T *data = arr.data();
+    unsigned chunks = chunkCount<T>(arr.getSize());
+    if (chunks == 1 || pool.getThreadCount() == 1) {
+        std::inclusive_scan(data, data + arr.getSize(), data, op);
+        return;
+    }
+
+    // Totals of the chunks
+    DArray<T> totals(chunks);
+    forChunks<T>(arr.getSize(), pool, [&](unsigned index, unsigned begin, unsigned end) {
+        *totals[int(index)] = std::accumulate(data + begin + 1, data + end, data[begin], op);
+    });
+    std::inclusive_scan(totals.begin(), totals.end(), totals.begin(), op);
+
+    // Scan every chunk, all but the first one start from the total of the previous chunks
+    forChunks<T>(arr.getSize(), pool, [&](unsigned index, unsigned begin, unsigned end) {
+        if (index == 0) std::inclusive_scan(data + begin, data + end, data + begin, op);
+        else std::inclusive_scan(data + begin, data + end, data + begin, op, *totals[int(index) - 1]);
+    });
+}
+
+
+/**
+ * Count the elements that satisfy the predicate
+ * @param[in] arr - array to check
+ * @param[in] pred - predicate, called concurrently
+ * @param[in] pool - threads to run on (def. = all cores)
+ * @return amount of the elements
+ */
+template <typename T, unsigned N, typename Pred>
+unsigned Parallel::count_if(const DArray<T, N> &arr, Pred pred, ThreadPool &pool) {
+    const T *data = arr.data();
+    std::atomic<unsigned> count = 0;
+    forChunks<T>(arr.getSize(), pool, [&](unsigned, unsigned begin, unsigned end) {
+        count.fetch_add(unsigned(std::count_if(data + begin, data + end, pred)), std::memory_order_relaxed);
+    });
+    return count.load();
+}
+
+
+/**
+ * Stable partition: elements that satisfy the predicate go first, both groups keep their order.
+ * Every chunk counts it's matches, the counts give each chunk it's place in both groups,
+ * then the chunks move their elements to a buffer in parallel and the buffer is moved back
+ * @param[in] arr - array to partition
+ * @param[in] pred - predicate, called concurrently (twice per element)
+ * @param[in] pool - threads to run on (def. = all cores)
+ * @return index of the first element that doesn't satisfy the predicate
+ */
+template <typename T, unsigned N, typename Pred>
+unsigned Parallel::partition(DArray<T, N> &arr, Pred pred, ThreadPool &pool) {
+    T *data = arr.data();
+    unsigned size = arr.getSize();
+    unsigned chunks = chunkCount<T>(size);
+    if (chunks <= 1 || pool.getThreadCount() == 1)
+        return unsigned(std::stable_partition(data, data + size, pred) - data);
+
+    // Matches before every chunk
+    DArray<unsigned> matches(chunks + 1, 0u);
+    forChunks<T>(size, pool, [&](unsigned index, unsigned begin, unsigned end) {
+        *matches[int(index) + 1] = unsigned(std::count_if(data + begin, data + end, pred));
+    });
+    std::inclusive_scan(matches.begin(), matches.end(), matches.begin());
+    unsigned total = *matches[-1];
+
+    // Move the elements to their places in the buffer and back
+    std::allocator<T> allocator;
+    T *buffer = allocator.allocate(size);
+    forChunks<T>(size, pool, [&](unsigned index, unsigned begin, unsigned end) {
+        unsigned matched = *matches[int(index)];
+        unsigned rest = total + begin - matched;
+        for (unsigned i = begin; i < end; ++i)
+            std::construct_at(buffer + (pred(data[i]) ? matched++ : rest++), std::move(data[i]));
+    });
+    forChunks<T>(size, pool, [&](unsigned, unsigned begin, unsigned end) {
+        std::move(buffer + begin, buffer + end, data + begin);
+        std::destroy(buffer + begin, buffer + end);
+    });
+    allocator.deallocate(buffer, size);
+
+    return total;
+}
+
+
+#endif //PRACTICE01_PARALLEL_H
@@ -0,0 +1,230 @@
+#ifndef PRACTICE01_RANGE_INDEX_H
+#define PRACTICE01_RANGE_INDEX_H
+
+#include "dynamic_array.h"
+#include <algorithm>
+#include <iostream>
+
+
+/**
+ * @class RangeIndex
+ * @brief Range sum and min/max queries over a DArray
+ * Sums are kept in a Fenwick tree, minimums and maximums in two bottom-up segment trees.
+ * Queries and set() take O(log n). insert(), remove() and append() change the array and rebuild
+ * the trees in O(n), build() does the same after the array was changed directly.
+ * The index refers to the array, which must outlive it
+ * @tparam T - type of the values, with +, - and <
+ */
+template <typename T>
+class RangeIndex {
+private:
+    DArray<T> &array;
+    DArray<T> fenwick;   // fenwick[i] is the sum of (i - lowbit(i), i], 1-based
+    DArray<T> minTree;   // Leaves at [n, 2n), node i covers it's children 2i and 2i+1
+    DArray<T> maxTree;
+    unsigned size = 0;
+
+    [[nodiscard]] T prefix(unsigned) const;
+    [[nodiscard]] bool isRange(unsigned, unsigned) const;
+    template <typename Compare>
+    [[nodiscard]] T query(const DArray<T>&, unsigned, unsigned, Compare) const;
+public:
+    // Constructors
+    explicit RangeIndex(DArray<T>&);
+    RangeIndex(const RangeIndex&) = delete;
+
+    // Operators
+    RangeIndex& operator= (const RangeIndex&) = delete;
+
+    // Methods
+    void build();
+    void set(unsigned, const T&);
+    void insert(unsigned, const T&);
+    void remove(unsigned);
+    void append(const T&);
+    [[nodiscard]] T prefixSum(unsigned) const;
+    [[nodiscard]] T sum(unsigned, unsigned) const;
+    [[nodiscard]] T min(unsigned, unsigned) const;
+    [[nodiscard]] T max(unsigned, unsigned) const;
+    [[nodiscard]] unsigned getSize() const;
+};
+
+
+/// Sum of the first [count] elements
+template <typename T>
+T RangeIndex<T>::prefix(unsigned count) const {
+    const T *tree = fenwick.data();
+    T result = T();
+    for (; count > 0; count &= count - 1)
+        result = result + tree[count];
+    return result;
+}
+
+
+/// Return true if [from, to) is a non-empty range of the array, else print the error
+template <typename T>
+bool RangeIndex<T>::isRange(unsigned from, unsigned to) const {
+    if (from >= to || to > size) {
+        std::cout << "IndexError: Index out of range\n";
+        return false;
+    }
+    return true;
+}
+
+
+/**
+ * Combine the leaves of [from, to) going up the segment tree
+ * @param[in] tree - minTree or maxTree
+ * @param[in] from - index of the first element
+ * @param[in] to - index after the last element
+ * @param[in] compare - returns true if the first value is preferred
+ * @return the preferred value of the range
+ */
+template <typename T>
+template <typename Compare>
+T RangeIndex<T>::query(const DArray<T> &tree, unsigned from, unsigned to, Compare compare) const {
+    const T *nodes = tree.data();
+    T result = nodes[from + size];
+    for (from += size, to += size; from < to; from /= 2, to /= 2) {
+        if (from & 1) { if (compare(nodes[from], result)) result = nodes[from]; from++; }
+        if (to & 1) { to--; if (compare(nodes[to], result)) result = nodes[to]; }
+    }
+    return result;
+}
+
+
+/// Attach the index to the array and build it
+template <typename T>
+RangeIndex<T>::RangeIndex(DArray<T> &array) : array(array) {
+    build();
+}
+
+
+/**
+ * Rebuild the trees from the array in O(n). Fenwick nodes pass their sums to the parents,
+ * segment tree nodes are computed from the children bottom-up
+ */
+template <typename T>
+void RangeIndex<T>::build() {
+    size = array.getSize();
+    const T *values = array.data();
+
+    fenwick = DArray<T>(size + 1);
+    T *tree = fenwick.data();
+    for (unsigned i = 1; i <= size; ++i) {
+        tree[i] = tree[i] + values[i - 1];
+        unsigned parent = i + (i & -i);
+        if (parent <= size) tree[parent] = tree[parent] + tree[i];
+    }
+
+    minTree = DArray<T>(2 * size);
+    maxTree = DArray<T>(2 * size);
+    T *low = minTree.data();
+    T *high = maxTree.data();
+    std::copy(values, values + size, low + size);
+    std::copy(values, values + size, high + size);
+    for (unsigned i = size; i-- > 1;) {
+        low[i] = std::min(low[2 * i], low[2 * i + 1]);
+        high[i] = std::max(high[2 * i], high[2 * i + 1]);
+    }
+}
+
+
+/**
+ * Change the element and update the trees in O(log n)
+ * @param[in] index - index of the element
+ * @param[in] value - new value
+ */
+template <typename T>
+void RangeIndex<T>::set(unsigned index, const T &value) {
+    if (index >= size) {
+        std::cout << "IndexError: Index out of range\n";
+        return;
+    }
+
+    T *element = array.data() + index;
+    T delta = value - *element;
+    *element = value;
+
+    T *tree = fenwick.data();
+    for (unsigned i = index + 1; i <= size; i += i & -i)
+        tree[i] = tree[i] + delta;
+
+    T *low = minTree.data();
+    T *high = maxTree.data();
+    unsigned node = index + size;
+    low[node] = high[node] = value;
+    for (node /= 2; node > 0; node /= 2) {
+        low[node] = std::min(low[2 * node], low[2 * node + 1]);
+        high[node] = std::max(high[2 * node], high[2 * node + 1]);
+    }
+}
+
+
+/// Insert the element to the array and rebuild the trees
+template <typename T>
+void RangeIndex<T>::insert(unsigned index, const T &value) {
+    array.insert(index, value);
+    build();
+}
+
+
+/// Remove the element from the array and rebuild the trees
+template <typename T>
+void RangeIndex<T>::remove(unsigned index) {
+    array.remove(index);
+    build();
+}
+
+
+/// Add the element to the end of the array and rebuild the trees
+template <typename T>
+void RangeIndex<T>::append(const T &value) {
+    array.append(value);
+    build();
+}
+
+
+/// Sum of the first [count] elements, O(log n)
+template <typename T>
+T RangeIndex<T>::prefixSum(unsigned count) const {
+    if (count > size) {
+        std::cout << "IndexError: Index out of range\n";
+        return T();
+    }
+    return prefix(count);
+}
+
+
+/// Sum of the elements in [from, to), O(log n)
+template <typename T>
+T RangeIndex<T>::sum(unsigned from, unsigned to) const {
+    if (!isRange(from, to)) return T();
+    return prefix(to) - prefix(from);
+}
+
+
+/// Smallest element in [from, to), O(log n)
+template <typename T>
+T RangeIndex<T>::min(unsigned from, unsigned to) const {
+    if (!isRange(from, to)) return T();
+    return query(minTree, from, to, [](const T &a, const T &b) { return a < b; });
+}
+
+
+/// Largest element in [from, to), O(log n)
+template <typename T>
+T RangeIndex<T>::max(unsigned from, unsigned to) const {
+    if (!isRange(from, to)) return T();
+    return query(maxTree, from, to, [](const T &a, const T &b) { return b < a; });
+}
+
+
+/// Return the amount of indexed elements
+template <typename T>
+unsigned RangeIndex<T>::getSize() const {
+    return size;
+}
+
+
+#endif //PRACTICE01_RANGE_INDEX_H
@@ -0,0 +1,431 @@
+#ifndef PRACTICE01_SEGMENTED_ARRAY_H
+#define PRACTICE01_SEGMENTED_ARRAY_H
+
+#include "stats.h"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <iostream>
+
+
+/**
+ * @class SegmentedDArray
+ * @brief Dynamic array of blocks that never moves it's elements
+ * Block k holds FIRST_BLOCK * 2^k elements, so the index of the block and the offset in it are
+ * computed from the leading zeros of the index in O(1). The table of blocks has a fixed size and never grows,
+ * MAX_BLOCKS blocks hold 2^32 - 16 elements, so the sizes stay unsigned. Growing allocates one block and copies
+ * nothing, so append() is O(1) in the worst case and pointers returned by get() stay valid until the element is removed
+ * @tparam T - type of the values
+ */
+template <typename T>
+class SegmentedDArray {
+public:
+    static constexpr unsigned FIRST_BLOCK_LOG = 4;
+    static constexpr unsigned FIRST_BLOCK = 1u << FIRST_BLOCK_LOG;
+    static constexpr unsigned MAX_BLOCKS = 28;
+    static_assert(FIRST_BLOCK * ((1ull << MAX_BLOCKS) - 1) <= std::numeric_limits<unsigned>::max(), "Capacity must fit unsigned");
+
+    template <bool isConst>
+    class Iterator;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+private:
+    T * blocks[MAX_BLOCKS] = {};  // Allocated blocks go first, the rest are nullptr
+    unsigned blockCount = 0;
+    unsigned size = 0;
+    [[no_unique_address]] Stats stats;
+
+    static unsigned blockSize(unsigned);
+    static unsigned blockOf(unsigned);
+    static unsigned offsetOf(unsigned, unsigned);
+    [[nodiscard]] T& at(unsigned) const;
+    void addBlock();
+public:
+    // Constructors and destructor
+    SegmentedDArray();
+    explicit SegmentedDArray(unsigned size, const T &value = T());
+    explicit SegmentedDArray(unsigned, const T*);
+    SegmentedDArray(const SegmentedDArray&);
+    SegmentedDArray(SegmentedDArray&&) noexcept;
+    ~SegmentedDArray();
+
+    // Operators
+    SegmentedDArray& operator= (const SegmentedDArray&);
+    SegmentedDArray& operator= (SegmentedDArray&&) noexcept;
+    T * operator[] (int);
+
+    // Iterators
+    iterator begin();
+    iterator end();
+    [[nodiscard]] const_iterator begin() const;
+    [[nodiscard]] const_iterator end() const;
+
+    // Methods
+    T * get(int);
+    [[nodiscard]] int find(const T&) const;
+    void clear();
+    void shrink_to_fit();
+    void resize(unsigned);
+    void append(const T&);
+    void append(T&&);
+    template <typename... Args>
+    T& emplace_back(Args&&...);
+    void remove(unsigned);
+    [[nodiscard]] unsigned getSize() const;
+    [[nodiscard]] unsigned getCapacity() const;
+    [[nodiscard]] bool isEmpty() const;
+    [[nodiscard]] const Stats& getStats() const;
+    void resetStats();
+};
+
+
+/**
+ * @class Iterator
+ * @brief Random access iterator over the elements of the SegmentedDArray
+ * Keeps the index, the element is found through the table of blocks in O(1)
+ * @tparam isConst - is the iterator const
+ */
+template <typename T>
+template <bool isConst>
+class SegmentedDArray<T>::Iterator {
+private:
+    using Array = std::conditional_t<isConst, const SegmentedDArray, SegmentedDArray>;
+    Array * _array = nullptr;
+    unsigned _index = 0;
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<isConst, const T*, T*>;
+    using reference = std::conditional_t<isConst, const T&, T&>;
+
+    Iterator() = default;
+    Iterator(Array *array, unsigned index) : _array(array), _index(index) {}
+
+    reference operator*() const { return _array->at(_index); }
+    pointer operator->() const { return &_array->at(_index); }
+    reference operator[](difference_type n) const { return _array->at(unsigned(_index + n)); }
+
+    Iterator& operator++() { ++_index; return *this; }
+    Iterator operator++(int) { Iterator old = *this; ++_index; return old; }
+    Iterator& operator--() { --_index; return *this; }
+    Iterator operator--(int) { Iterator old = *this; --_index; return old; }
+    Iterator& operator+=(difference_type n) { _index = unsigned(_index + n); return *this; }
+    Iterator& operator-=(difference_type n) { _index = unsigned(_index - n); return *this; }
+    Iterator operator+(difference_type n) const { return Iterator(_array, unsigned(_index + n)); }
+    Iterator operator-(difference_type n) const { return Iterator(_array, unsigned(_index - n)); }
+    friend Iterator operator+(difference_type n, const Iterator &it) { return it + n; }
+    difference_type operator-(const Iterator &other) const { return difference_type(_index) - difference_type(other._index); }
+
+    bool operator==(const Iterator &other) const { return _index == other._index; }
+    auto operator<=>(const Iterator &other) const { return _index <=> other._index; }
+};
+
+
+/// Amount of elements in the block
+template <typename T>
+unsigned SegmentedDArray<T>::blockSize(unsigned block) {
+    return FIRST_BLOCK << block;
+}
+
+
+/// Number of the block that holds the index. Blocks end at FIRST_BLOCK * (2^(k+1) - 1)
+template <typename T>
+unsigned SegmentedDArray<T>::blockOf(unsigned index) {
+    unsigned long long shifted = (unsigned long long)index + FIRST_BLOCK;
+    return unsigned(63 - std::countl_zero(shifted)) - FIRST_BLOCK_LOG;
+}
+
+
+/// Position of the index in it's block
+template <typename T>
+unsigned SegmentedDArray<T>::offsetOf(unsigned index, unsigned block) {
+    return unsigned((unsigned long long)index + FIRST_BLOCK - ((unsigned long long)FIRST_BLOCK << block));
+}
+
+
+/// Element by index without the range check
+template <typename T>
+T& SegmentedDArray<T>::at(unsigned index) const {
+    unsigned block = blockOf(index);
+    return blocks[block][offsetOf(index, block)];
+}
+
+
+/// Allocate the next block. Nothing is moved. Throws std::length_error if all MAX_BLOCKS blocks are allocated
+template <typename T>
+void SegmentedDArray<T>::addBlock() {
+    if (blockCount == MAX_BLOCKS) throw std::length_error("SegmentedDArray capacity exceeded");
+    blocks[blockCount] = std::allocator<T>().allocate(blockSize(blockCount));
+    stats.allocated(blockSize(blockCount) * sizeof(T));
+    blockCount++;
+}
+
+
+/// Default constructor. Nothing is allocated until the first element
+template <typename T>
+SegmentedDArray<T>::SegmentedDArray() = default;
+
+
+/// Creates array with [n] copies of [value]
+template <typename T>
+SegmentedDArray<T>::SegmentedDArray(unsigned n, const T &value) {
+    for (unsigned i = 0; i < n; ++i) append(value);
+}
+
+
+/// Creates array by array values
+template <typename T>
+SegmentedDArray<T>::SegmentedDArray(unsigned n, const T *values) {
+    for (unsigned i = 0; i < n; ++i) append(values[i]);
+}
+
+
+/// Copy constructor
+template <typename T>
+SegmentedDArray<T>::SegmentedDArray(const SegmentedDArray &other) {
+    for (const T &value : other) append(value);
+}
+
+
+/// Move constructor. Blocks are taken from the other array, which becomes empty
+template <typename T>
+SegmentedDArray<T>::SegmentedDArray(SegmentedDArray &&other) noexcept
+    : blockCount(std::exchange(other.blockCount, 0)), size(std::exchange(other.size, 0)),
+      stats(std::exchange(other.stats, {})) {
+    std::copy(other.blocks, other.blocks + MAX_BLOCKS, blocks);
+    std::fill(other.blocks, other.blocks + MAX_BLOCKS, nullptr);
+}
+
+
+/// Destructor
+template <typename T>
+SegmentedDArray<T>::~SegmentedDArray() {
+    clear();
+    shrink_to_fit();
+}
+
+
+/// Assignment operator
+template <typename T>
+SegmentedDArray<T>& SegmentedDArray<T>::operator= (const SegmentedDArray &rhs) {
+    // Self-assignment handler
+    if (this == &rhs) return *this;
+
+    // Blocks are reused
+    clear();
+    for (const T &value : rhs) append(value);
+
+    return *this;
+}
+
+
+/// Move assignment operator. Blocks are taken from rhs, which becomes empty
+template <typename T>
+SegmentedDArray<T>& SegmentedDArray<T>::operator= (SegmentedDArray &&rhs) noexcept {
+    // Self-assignment handler
+    if (this == &rhs) return *this;
+
+    clear();
+    shrink_to_fit();
+    std::copy(rhs.blocks, rhs.blocks + MAX_BLOCKS, blocks);
+    std::fill(rhs.blocks, rhs.blocks + MAX_BLOCKS, nullptr);
+    blockCount = std::exchange(rhs.blockCount, 0);
+    size = std::exchange(rhs.size, 0);
+    stats += std::exchange(rhs.stats, {});
+
+    return *this;
+}
+
+
+/// Print the array
+template <typename T>
+std::ostream& operator<< (std::ostream& os, const SegmentedDArray<T>& arr) {
+    for (const T &value : arr)
+        os << value << ' ';
+    return os;
+}
+
+
+/// Get element by it`s index via [] operator
+template <typename T>
+T * SegmentedDArray<T>::operator[] (int index) {
+    return get(index);
+}
+
+
+/// Iterator to the first element
+template <typename T>
+typename SegmentedDArray<T>::iterator SegmentedDArray<T>::begin() {
+    return iterator(this, 0);
+}
+
+
+/// Iterator past the last element
+template <typename T>
+typename SegmentedDArray<T>::iterator SegmentedDArray<T>::end() {
+    return iterator(this, size);
+}
+
+
+/// Const iterator to the first element
+template <typename T>
+typename SegmentedDArray<T>::const_iterator SegmentedDArray<T>::begin() const {
+    return const_iterator(this, 0);
+}
+
+
+/// Const iterator past the last element
+template <typename T>
+typename SegmentedDArray<T>::const_iterator SegmentedDArray<T>::end() const {
+    return const_iterator(this, size);
+}
+
+
+/// Get element by it`s index. Negative index counts from the end. The pointer stays valid until the element is removed
+template <typename T>
+T * SegmentedDArray<T>::get(int index) {
+    if (isEmpty()) {
+        std::cout << "IndexError: The array is empty\n";
+        return nullptr;
+    } else if (index >= int(getSize()) || index < -int(getSize())) {
+        std::cout << "IndexError: Index out of range\n";
+        return nullptr;
+    } else if (index < 0) {
+        index = int(getSize()) + index;
+    }
+
+    return &at(unsigned(index));
+}
+
+
+/// Return index if element found else -1. Scans block by block
+template <typename T>
+int SegmentedDArray<T>::find(const T &value) const {
+    unsigned index = 0;
+    for (unsigned block = 0; block < blockCount && index < size; ++block) {
+        unsigned count = std::min(blockSize(block), size - index);
+        for (unsigned i = 0; i < count; ++i)
+            if (blocks[block][i] == value) return int(index + i);
+        index += count;
+    }
+    return -1;
+}
+
+
+/// Remove all the elements. The blocks are kept
+template <typename T>
+void SegmentedDArray<T>::clear() {
+    while (size) std::destroy_at(&at(--size));
+}
+
+
+/// Free the blocks past the last element
+template <typename T>
+void SegmentedDArray<T>::shrink_to_fit() {
+    unsigned needed = size ? blockOf(size - 1) + 1 : 0;
+    while (blockCount > needed) {
+        blockCount--;
+        std::allocator<T>().deallocate(blocks[blockCount], blockSize(blockCount));
+        stats.freed(blockSize(blockCount) * sizeof(T));
+        blocks[blockCount] = nullptr;
+    }
+}
+
+
+/// Change the amount of the elements. New elements are value-initialized
+template <typename T>
+void SegmentedDArray<T>::resize(unsigned newSize) {
+    while (size > newSize) std::destroy_at(&at(--size));
+    while (size < newSize) emplace_back();
+}
+
+
+/// Add copy of the element to the end of the array
+template <typename T>
+void SegmentedDArray<T>::append(const T &value) {
+    emplace_back(value);
+}
+
+
+/// Move the element to the end of the array
+template <typename T>
+void SegmentedDArray<T>::append(T &&value) {
+    emplace_back(std::move(value));
+}
+
+
+/**
+ * Construct the element in place at the end of the array. O(1) in the worst case.
+ * Throws std::length_error when all MAX_BLOCKS blocks are full
+ * @param[in] args - arguments forwarded to the constructor of T
+ * @return reference to the new element, stays valid until it's removed
+ */
+template <typename T>
+template <typename... Args>
+T& SegmentedDArray<T>::emplace_back(Args&&... args) {
+    if (size == getCapacity()) addBlock();
+
+    T *element = std::construct_at(&at(size), std::forward<Args>(args)...);
+    size++;
+    stats.sized(size);
+    return *element;
+}
+
+
+/// Remove element by it`s index. Following elements are shifted, so their pointers refer to the next values
+template <typename T>
+void SegmentedDArray<T>::remove(unsigned index) {
+    if (index >= size) {
+        std::cout << "IndexError: Index out of range\n";
+        return;
+    }
+
+    for (unsigned i = index; i + 1 < size; ++i)
+        at(i) = std::move(at(i + 1));
+    std::destroy_at(&at(--size));
+}
+
+
+/// Return the amount of elements
+template <typename T>
+unsigned SegmentedDArray<T>::getSize() const {
+    return size;
+}
+
+
+/// Return the amount of elements the allocated blocks hold
+template <typename T>
+unsigned SegmentedDArray<T>::getCapacity() const {
+    return FIRST_BLOCK * ((1u << blockCount) - 1);
+}
+
+
+/// Return true if the array has no elements
+template <typename T>
+bool SegmentedDArray<T>::isEmpty() const {
+    return size == 0;
+}
+
+
+/// Return the counters of the array (empty unless ADS_STATS is defined)
+template <typename T>
+const Stats& SegmentedDArray<T>::getStats() const {
+    return stats;
+}
+
+
+/// Reset the counters of the array
+template <typename T>
+void SegmentedDArray<T>::resetStats() {
+    stats = {};
+}
+
+
+#endif //PRACTICE01_SEGMENTED_ARRAY_H
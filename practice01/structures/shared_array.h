@@ -0,0 +1,350 @@
+#ifndef PRACTICE01_SHARED_ARRAY_H
+#define PRACTICE01_SHARED_ARRAY_H
+
+#include "dynamic_array.h"
+#include <atomic>
+#include <utility>
+#include <iostream>
+
+
+/**
+ * @class SharedDArray
+ * @brief Copy-on-write dynamic array
+ * Copies share one reference-counted DArray, so a copy is O(1) whatever the size. The first change made
+ * through a copy (append, insert, remove, clear, writing through get() or an iterator) detaches it: if the
+ * storage is shared, the copy gets it's own DArray first. Const methods never copy.
+ * Non-const get(), [], begin(), end() and data() hand out pointers for writing, so they also mark the storage
+ * unshareable: later copies get their own DArray at once and writes through the pointers never reach them.
+ * The mark stays until clear().
+ * Copies may be read and released by different threads, one object must not be changed concurrently
+ * @tparam T - type of the values
+ */
+template <typename T>
+class SharedDArray {
+private:
+    struct Buffer {
+        std::atomic<unsigned> references = 1;
+        DArray<T> array;
+        bool isUnshareable = false;  // A pointer for writing was handed out, set by the only owner
+    };
+
+    Buffer * buffer = nullptr;  // nullptr for the empty array
+
+    static Buffer * share(Buffer*);
+    void release();
+    DArray<T>& detach();
+    DArray<T>& expose();
+public:
+    // Constructors and destructor
+    SharedDArray();
+    explicit SharedDArray(unsigned, const T*);
+    explicit SharedDArray(DArray<T>&&);
+    SharedDArray(const SharedDArray&);
+    SharedDArray(SharedDArray&&) noexcept;
+    ~SharedDArray();
+
+    // Operators
+    SharedDArray& operator= (const SharedDArray&);
+    SharedDArray& operator= (SharedDArray&&) noexcept;
+    T * operator[] (int);
+    const T * operator[] (int) const;
+
+    // Iterators
+    T * begin();
+    T * end();
+    [[nodiscard]] const T * begin() const;
+    [[nodiscard]] const T * end() const;
+
+    // Methods
+    T * get(int);
+    const T * get(int) const;
+    [[nodiscard]] const DArray<T>& view() const;
+    [[nodiscard]] int find(const T&) const;
+    [[nodiscard]] unsigned count(const T&) const;
+    void clear();
+    void reserve(unsigned);
+    void resize(unsigned);
+    void append(const T&);
+    void append(T&&);
+    void insert(unsigned, const T&);
+    void remove(unsigned);
+    T * data();
+    [[nodiscard]] const T * data() const;
+    [[nodiscard]] unsigned getSize() const;
+    [[nodiscard]] bool isEmpty() const;
+    [[nodiscard]] bool isShared() const;
+};
+
+
+/// Reference to the storage for a new copy: the same buffer or own copy of it if the buffer is unshareable
+template <typename T>
+typename SharedDArray<T>::Buffer * SharedDArray<T>::share(Buffer *source) {
+    if (!source) return nullptr;
+    if (source->isUnshareable) return new Buffer{1, source->array};
+    source->references.fetch_add(1, std::memory_order_relaxed);
+    return source;
+}
+
+
+/// Drop the reference to the storage, the last one frees it
+template <typename T>
+void SharedDArray<T>::release() {
+    if (buffer && buffer->references.fetch_sub(1, std::memory_order_acq_rel) == 1) delete buffer;
+    buffer = nullptr;
+}
+
+
+/// Make the storage owned by this array only, copying it if it's shared. Return the owned array
+template <typename T>
+DArray<T>& SharedDArray<T>::detach() {
+    if (!buffer) buffer = new Buffer;
+    else if (buffer->references.load(std::memory_order_acquire) != 1) {
+        Buffer *copy = new Buffer{1, buffer->array};
+        release();
+        buffer = copy;
+    }
+    return buffer->array;
+}
+
+
+/// Detach the storage and mark it unshareable before a pointer for writing is handed out
+template <typename T>
+DArray<T>& SharedDArray<T>::expose() {
+    DArray<T> &array = detach();
+    buffer->isUnshareable = true;
+    return array;
+}
+
+
+/// Default constructor. Nothing is allocated until the first change
+template <typename T>
+SharedDArray<T>::SharedDArray() = default;
+
+
+/// Creates array by array values
+template <typename T>
+SharedDArray<T>::SharedDArray(unsigned n, const T *values) : buffer(new Buffer{1, DArray<T>(n, values)}) {}
+
+
+/// Take the storage of the dynamic array, nothing is copied
+template <typename T>
+SharedDArray<T>::SharedDArray(DArray<T> &&array) : buffer(new Buffer{1, std::move(array)}) {}
+
+
+/// Copy constructor. Shares the storage in O(1) unless it's unshareable
+template <typename T>
+SharedDArray<T>::SharedDArray(const SharedDArray &other) : buffer(share(other.buffer)) {}
+
+
+/// Move constructor. The reference is taken from the other array, which becomes empty
+template <typename T>
+SharedDArray<T>::SharedDArray(SharedDArray &&other) noexcept : buffer(std::exchange(other.buffer, nullptr)) {}
+
+
+/// Destructor
+template <typename T>
+SharedDArray<T>::~SharedDArray() {
+    release();
+}
+
+
+/// Assignment operator. Shares the storage in O(1) unless it's unshareable
+template <typename T>
+SharedDArray<T>& SharedDArray<T>::operator= (const SharedDArray &rhs) {
+    // Self-assignment handler
+    if (buffer == rhs.buffer) return *this;
+
+    release();
+    buffer = share(rhs.buffer);
+
+    return *this;
+}
+
+
+/// Move assignment operator. The reference is taken from rhs, which becomes empty
+template <typename T>
+SharedDArray<T>& SharedDArray<T>::operator= (SharedDArray &&rhs) noexcept {
+    // Self-assignment handler
+    if (this == &rhs) return *this;
+
+    release();
+    buffer = std::exchange(rhs.buffer, nullptr);
+
+    return *this;
+}
+
+
+/// Print the array
+template <typename T>
+std::ostream& operator<< (std::ostream& os, const SharedDArray<T>& arr) {
+    return os << arr.view();
+}
+
+
+/// Get element by it`s index via [] operator. Detaches the storage and marks it unshareable
+template <typename T>
+T * SharedDArray<T>::operator[] (int index) {
+    return get(index);
+}
+
+
+/// Get element by it`s index via [] operator for reading
+template <typename T>
+const T * SharedDArray<T>::operator[] (int index) const {
+    return get(index);
+}
+
+
+/// Pointer to the first element. Detaches the storage and marks it unshareable
+template <typename T>
+T * SharedDArray<T>::begin() {
+    return expose().begin();
+}
+
+
+/// Pointer past the last element. Detaches the storage and marks it unshareable
+template <typename T>
+T * SharedDArray<T>::end() {
+    return expose().end();
+}
+
+
+/// Const pointer to the first element
+template <typename T>
+const T * SharedDArray<T>::begin() const {
+    return view().begin();
+}
+
+
+/// Const pointer past the last element
+template <typename T>
+const T * SharedDArray<T>::end() const {
+    return view().end();
+}
+
+
+/// Get element by it`s index for writing. Detaches the storage and marks it unshareable
+template <typename T>
+T * SharedDArray<T>::get(int index) {
+    return expose().get(index);
+}
+
+
+/// Get element by it`s index for reading
+template <typename T>
+const T * SharedDArray<T>::get(int index) const {
+    return const_cast<DArray<T>&>(view()).get(index);
+}
+
+
+/// Shared storage for reading, e.g. for the search methods of DArray
+template <typename T>
+const DArray<T>& SharedDArray<T>::view() const {
+    static const DArray<T> empty;
+    return buffer ? buffer->array : empty;
+}
+
+
+/// Return index if element found else -1
+template <typename T>
+int SharedDArray<T>::find(const T &value) const {
+    return view().find(value);
+}
+
+
+/// Return amount of elements equal to the value
+template <typename T>
+unsigned SharedDArray<T>::count(const T &value) const {
+    return view().count(value);
+}
+
+
+/// Remove all the elements. Shared storage is left to the other copies, own storage becomes shareable
+template <typename T>
+void SharedDArray<T>::clear() {
+    if (isShared()) release();
+    else if (buffer) {
+        buffer->array.clear();
+        buffer->isUnshareable = false;
+    }
+}
+
+
+/// Make sure that the array holds at least the given amount of elements. Detaches the storage
+template <typename T>
+void SharedDArray<T>::reserve(unsigned capacity) {
+    detach().reserve(capacity);
+}
+
+
+/// Change the amount of elements. Detaches the storage
+template <typename T>
+void SharedDArray<T>::resize(unsigned size) {
+    detach().resize(size);
+}
+
+
+/// Add copy of the element to the end of the array. Detaches the storage
+template <typename T>
+void SharedDArray<T>::append(const T &value) {
+    detach().append(value);
+}
+
+
+/// Move the element to the end of the array. Detaches the storage
+template <typename T>
+void SharedDArray<T>::append(T &&value) {
+    detach().append(std::move(value));
+}
+
+
+/// Insert the element to the specified position. Detaches the storage
+template <typename T>
+void SharedDArray<T>::insert(unsigned index, const T &value) {
+    detach().insert(index, value);
+}
+
+
+/// Remove element by it`s index. Detaches the storage
+template <typename T>
+void SharedDArray<T>::remove(unsigned index) {
+    detach().remove(index);
+}
+
+
+/// Pointer to the storage for writing. Detaches the storage and marks it unshareable
+template <typename T>
+T * SharedDArray<T>::data() {
+    return expose().data();
+}
+
+
+/// Pointer to the storage for reading
+template <typename T>
+const T * SharedDArray<T>::data() const {
+    return view().data();
+}
+
+
+/// Return the amount of elements
+template <typename T>
+unsigned SharedDArray<T>::getSize() const {
+    return view().getSize();
+}
+
+
+/// Return true if the array has no elements
+template <typename T>
+bool SharedDArray<T>::isEmpty() const {
+    return view().isEmpty();
+}
+
+
+/// Return true if the storage is shared with other copies, so the next change copies it
+template <typename T>
+bool SharedDArray<T>::isShared() const {
+    return buffer && buffer->references.load(std::memory_order_acquire) != 1;
+}
+
+
+#endif //PRACTICE01_SHARED_ARRAY_H
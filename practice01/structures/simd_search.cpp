@@ -0,0 +1,551 @@
+#include "simd_search.h"
+
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+// Vector kernels are compiled for x86 only, other targets use the scalar ones
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_SEARCH_X86
+#include <immintrin.h>
+#endif
+
+
+/// Elements of one block of the array (16 KB), a block stays in L1 cache while the keys are checked in it
+static const unsigned BLOCK_SIZE = 4096;
+
+/// Key sets larger than this are hashed: a lookup per element is cheaper than comparing it with every key
+static const unsigned HASHED_KEYS = 32;
+
+
+/// Table of kernels of one instruction set
+struct Kernels {
+    int (*find)(const int*, unsigned, int);
+    unsigned (*count)(const int*, unsigned, int);
+    unsigned (*findAll)(const int*, unsigned, int, int*);
+    int (*min)(const int*, unsigned);
+    int (*max)(const int*, unsigned);
+    bool (*containsAny)(const int*, unsigned, const int*, unsigned);
+};
+
+
+// Scalar kernels. Also used for the tails of the vector ones
+
+static int findScalar(const int *data, unsigned size, int value) {
+    for (unsigned i = 0; i < size; ++i)
+        if (data[i] == value) return int(i);
+    return -1;
+}
+
+
+static unsigned countScalar(const int *data, unsigned size, int value) {
+    unsigned result = 0;
+    for (unsigned i = 0; i < size; ++i)
+        result += data[i] == value;
+    return result;
+}
+
+
+static unsigned findAllScalar(const int *data, unsigned size, int value, int *indexes) {
+    unsigned found = 0;
+    for (unsigned i = 0; i < size; ++i)
+        if (data[i] == value) indexes[found++] = int(i);
+    return found;
+}
+
+
+static int minScalar(const int *data, unsigned size) {
+    return *std::min_element(data, data + size);
+}
+
+
+static int maxScalar(const int *data, unsigned size) {
+    return *std::max_element(data, data + size);
+}
+
+
+static bool containsAnyScalar(const int *data, unsigned size, const int *values, unsigned count) {
+    for (unsigned i = 0; i < size; ++i)
+        for (unsigned j = 0; j < count; ++j)
+            if (data[i] == values[j]) return true;
+    return false;
+}
+
+
+#ifdef SIMD_SEARCH_X86
+
+// SSE4.1 kernels. 4 lanes, 4 vectors per iteration
+
+__attribute__((target("sse4.1")))
+static int findSse(const int *data, unsigned size, int value) {
+    const __m128i key = _mm_set1_epi32(value);
+    unsigned i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i eq[4];
+        for (int j = 0; j < 4; ++j)
+            eq[j] = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 4 * j)), key);
+        __m128i any = _mm_or_si128(_mm_or_si128(eq[0], eq[1]), _mm_or_si128(eq[2], eq[3]));
+        if (_mm_testz_si128(any, any)) continue;
+        for (int j = 0; j < 4; ++j) {
+            int mask = _mm_movemask_ps(_mm_castsi128_ps(eq[j]));
+            if (mask) return int(i + 4 * j + __builtin_ctz(mask));
+        }
+    }
+    int tail = findScalar(data + i, size - i, value);
+    return tail < 0 ? -1 : int(i) + tail;
+}
+
+
+__attribute__((target("sse4.1")))
+static unsigned countSse(const int *data, unsigned size, int value) {
+    const __m128i key = _mm_set1_epi32(value);
+    __m128i acc[4] = {_mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128()};
+    unsigned i = 0;
+    for (; i + 16 <= size; i += 16)
+        for (int j = 0; j < 4; ++j)  // Equal lanes are -1
+            acc[j] = _mm_sub_epi32(acc[j], _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 4 * j)), key));
+
+    __m128i sum = _mm_add_epi32(_mm_add_epi32(acc[0], acc[1]), _mm_add_epi32(acc[2], acc[3]));
+    alignas(16) unsigned lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), sum);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + countScalar(data + i, size - i, value);
+}
+
+
+__attribute__((target("sse4.1")))
+static unsigned findAllSse(const int *data, unsigned size, int value, int *indexes) {
+    const __m128i key = _mm_set1_epi32(value);
+    unsigned found = 0, i = 0;
+    for (; i + 4 <= size; i += 4) {
+        __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), key);
+        for (int mask = _mm_movemask_ps(_mm_castsi128_ps(eq)); mask; mask &= mask - 1)
+            indexes[found++] = int(i + __builtin_ctz(mask));
+    }
+    for (; i < size; ++i)
+        if (data[i] == value) indexes[found++] = int(i);
+    return found;
+}
+
+
+__attribute__((target("sse4.1")))
+static int minSse(const int *data, unsigned size) {
+    __m128i acc[4];
+    for (auto &el : acc) el = _mm_set1_epi32(INT_MAX);
+    unsigned i = 0;
+    for (; i + 16 <= size; i += 16)
+        for (int j = 0; j < 4; ++j)
+            acc[j] = _mm_min_epi32(acc[j], _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 4 * j)));
+
+    alignas(16) int lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), _mm_min_epi32(_mm_min_epi32(acc[0], acc[1]), _mm_min_epi32(acc[2], acc[3])));
+    int result = *std::min_element(lanes, lanes + 4);
+    return i < size ? std::min(result, minScalar(data + i, size - i)) : result;
+}
+
+
+__attribute__((target("sse4.1")))
+static int maxSse(const int *data, unsigned size) {
+    __m128i acc[4];
+    for (auto &el : acc) el = _mm_set1_epi32(INT_MIN);
+    unsigned i = 0;
+    for (; i + 16 <= size; i += 16)
+        for (int j = 0; j < 4; ++j)
+            acc[j] = _mm_max_epi32(acc[j], _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 4 * j)));
+
+    alignas(16) int lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), _mm_max_epi32(_mm_max_epi32(acc[0], acc[1]), _mm_max_epi32(acc[2], acc[3])));
+    int result = *std::max_element(lanes, lanes + 4);
+    return i < size ? std::max(result, maxScalar(data + i, size - i)) : result;
+}
+
+
+__attribute__((target("sse4.1")))
+static bool containsAnySse(const int *data, unsigned size, const int *values, unsigned count) {
+    // Up to 8 keys are kept in registers, larger sets are checked in groups block by block,
+    // so the array is read from memory once
+    for (unsigned start = 0; start < size; start += BLOCK_SIZE) {
+        const int *block = data + start;
+        unsigned length = std::min(BLOCK_SIZE, size - start);
+        for (unsigned group = 0; group < count; group += 8) {
+            unsigned keysCount = std::min(8u, count - group);
+            __m128i keys[8];
+            for (unsigned k = 0; k < keysCount; ++k) keys[k] = _mm_set1_epi32(values[group + k]);
+
+            unsigned i = 0;
+            for (; i + 4 <= length; i += 4) {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+                __m128i any = _mm_setzero_si128();
+                for (unsigned k = 0; k < keysCount; ++k) any = _mm_or_si128(any, _mm_cmpeq_epi32(chunk, keys[k]));
+                if (!_mm_testz_si128(any, any)) return true;
+            }
+            if (containsAnyScalar(block + i, length - i, values + group, keysCount)) return true;
+        }
+    }
+    return false;
+}
+
+
+// AVX2 kernels. 8 lanes, 4 vectors per iteration
+
+__attribute__((target("avx2")))
+static int findAvx2(const int *data, unsigned size, int value) {
+    const __m256i key = _mm256_set1_epi32(value);
+    unsigned i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i eq[4];
+        for (int j = 0; j < 4; ++j)
+            eq[j] = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 8 * j)), key);
+        __m256i any = _mm256_or_si256(_mm256_or_si256(eq[0], eq[1]), _mm256_or_si256(eq[2], eq[3]));
+        if (_mm256_testz_si256(any, any)) continue;
+        for (int j = 0; j < 4; ++j) {
+            int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq[j]));
+            if (mask) return int(i + 8 * j + __builtin_ctz(mask));
+        }
+    }
+    int tail = findSse(data + i, size - i, value);
+    return tail < 0 ? -1 : int(i) + tail;
+}
+
+
+__attribute__((target("avx2")))
+static unsigned countAvx2(const int *data, unsigned size, int value) {
+    const __m256i key = _mm256_set1_epi32(value);
+    __m256i acc[4] = {_mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256()};
+    unsigned i = 0;
+    for (; i + 32 <= size; i += 32)
+        for (int j = 0; j < 4; ++j)  // Equal lanes are -1
+            acc[j] = _mm256_sub_epi32(acc[j], _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 8 * j)), key));
+
+    __m256i sum = _mm256_add_epi32(_mm256_add_epi32(acc[0], acc[1]), _mm256_add_epi32(acc[2], acc[3]));
+    alignas(32) unsigned lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), sum);
+    unsigned result = 0;
+    for (unsigned lane : lanes) result += lane;
+    return result + countSse(data + i, size - i, value);
+}
+
+
+__attribute__((target("avx2")))
+static unsigned findAllAvx2(const int *data, unsigned size, int value, int *indexes) {
+    const __m256i key = _mm256_set1_epi32(value);
+    unsigned found = 0, i = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), key);
+        for (int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq)); mask; mask &= mask - 1)
+            indexes[found++] = int(i + __builtin_ctz(mask));
+    }
+    for (; i < size; ++i)
+        if (data[i] == value) indexes[found++] = int(i);
+    return found;
+}
+
+
+__attribute__((target("avx2")))
+static int minAvx2(const int *data, unsigned size) {
+    __m256i acc[4];
+    for (auto &el : acc) el = _mm256_set1_epi32(INT_MAX);
+    unsigned i = 0;
+    for (; i + 32 <= size; i += 32)
+        for (int j = 0; j < 4; ++j)
+            acc[j] = _mm256_min_epi32(acc[j], _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 8 * j)));
+
+    alignas(32) int lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), _mm256_min_epi32(_mm256_min_epi32(acc[0], acc[1]), _mm256_min_epi32(acc[2], acc[3])));
+    int result = *std::min_element(lanes, lanes + 8);
+    return i < size ? std::min(result, minSse(data + i, size - i)) : result;
+}
+
+
+__attribute__((target("avx2")))
+static int maxAvx2(const int *data, unsigned size) {
+    __m256i acc[4];
+    for (auto &el : acc) el = _mm256_set1_epi32(INT_MIN);
+    unsigned i = 0;
+    for (; i + 32 <= size; i += 32)
+        for (int j = 0; j < 4; ++j)
+            acc[j] = _mm256_max_epi32(acc[j], _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 8 * j)));
+
+    alignas(32) int lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), _mm256_max_epi32(_mm256_max_epi32(acc[0], acc[1]), _mm256_max_epi32(acc[2], acc[3])));
+    int result = *std::max_element(lanes, lanes + 8);
+    return i < size ? std::max(result, maxSse(data + i, size - i)) : result;
+}
+
+
+__attribute__((target("avx2")))
+static bool containsAnyAvx2(const int *data, unsigned size, const int *values, unsigned count) {
+    // Up to 8 keys are kept in registers, larger sets are checked in groups block by block,
+    // so the array is read from memory once
+    for (unsigned start = 0; start < size; start += BLOCK_SIZE) {
+        const int *block = data + start;
+        unsigned length = std::min(BLOCK_SIZE, size - start);
+        for (unsigned group = 0; group < count; group += 8) {
+            unsigned keysCount = std::min(8u, count - group);
+            __m256i keys[8];
+            for (unsigned k = 0; k < keysCount; ++k) keys[k] = _mm256_set1_epi32(values[group + k]);
+
+            unsigned i = 0;
+            for (; i + 8 <= length; i += 8) {
+                __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + i));
+                __m256i any = _mm256_setzero_si256();
+                for (unsigned k = 0; k < keysCount; ++k) any = _mm256_or_si256(any, _mm256_cmpeq_epi32(chunk, keys[k]));
+                if (!_mm256_testz_si256(any, any)) return true;
+            }
+            if (containsAnyScalar(block + i, length - i, values + group, keysCount)) return true;
+        }
+    }
+    return false;
+}
+
+#endif
+
+
+static const Kernels SCALAR_KERNELS = {findScalar, countScalar, findAllScalar, minScalar, maxScalar, containsAnyScalar};
+#ifdef SIMD_SEARCH_X86
+static const Kernels SSE_KERNELS = {findSse, countSse, findAllSse, minSse, maxSse, containsAnySse};
+static const Kernels AVX2_KERNELS = {findAvx2, countAvx2, findAllAvx2, minAvx2, maxAvx2, containsAnyAvx2};
+#endif
+
+
+/**
+ * @class KeySet
+ * @brief Open addressing hash set of the keys of one search
+ * The table is at most a quarter full and the keys are placed by Fibonacci hashing, so a lookup
+ * takes one or two probes whatever the amount of keys is. Most lookups miss, a sparse table keeps them short
+ */
+class KeySet {
+private:
+    struct Slot {
+        int key;
+        bool isUsed;
+    };
+
+    std::vector<Slot> slots;
+    unsigned shift = 31;
+    unsigned size = 0;
+
+    [[nodiscard]] unsigned homeOf(int) const;
+public:
+    KeySet(const int*, unsigned);
+
+    [[nodiscard]] int find(int) const;
+    [[nodiscard]] unsigned getSize() const;
+    [[nodiscard]] unsigned getCapacity() const;
+};
+
+
+/// Slot where the probing of the key starts
+unsigned KeySet::homeOf(int key) const {
+    return (unsigned(key) * 0x9E3779B1u) >> shift;
+}
+
+
+/**
+ * Hash the keys, repeated keys are stored once
+ * @param[in] keys - keys to store
+ * @param[in] count - amount of keys
+ */
+KeySet::KeySet(const int *keys, unsigned count) {
+    while ((1ull << (32 - shift)) < 4ull * count) shift--;
+    slots.assign(1u << (32 - shift), Slot{0, false});
+
+    const unsigned mask = getCapacity() - 1;
+    for (unsigned k = 0; k < count; ++k) {
+        unsigned slot = homeOf(keys[k]);
+        while (slots[slot].isUsed && slots[slot].key != keys[k]) slot = (slot + 1) & mask;
+        if (slots[slot].isUsed) continue;
+        slots[slot] = {keys[k], true};
+        size++;
+    }
+}
+
+
+/// Return slot of the key or -1 if there is no such key
+int KeySet::find(int key) const {
+    const unsigned mask = getCapacity() - 1;
+    for (unsigned slot = homeOf(key); slots[slot].isUsed; slot = (slot + 1) & mask)
+        if (slots[slot].key == key) return int(slot);
+    return -1;
+}
+
+
+/// Return amount of the distinct keys
+unsigned KeySet::getSize() const {
+    return size;
+}
+
+
+/// Return amount of the slots, the slot indexes are below it
+unsigned KeySet::getCapacity() const {
+    return unsigned(slots.size());
+}
+
+
+/// Kernels of the given level. Level must be supported
+static const Kernels * kernelsOf(SimdSearch::Level level) {
+#ifdef SIMD_SEARCH_X86
+    if (level == SimdSearch::Level::AVX2) return &AVX2_KERNELS;
+    if (level == SimdSearch::Level::SSE41) return &SSE_KERNELS;
+#endif
+    return &SCALAR_KERNELS;
+}
+
+
+/// Best level supported by the CPU
+static SimdSearch::Level detectLevel() {
+    if (SimdSearch::isSupported(SimdSearch::Level::AVX2)) return SimdSearch::Level::AVX2;
+    if (SimdSearch::isSupported(SimdSearch::Level::SSE41)) return SimdSearch::Level::SSE41;
+    return SimdSearch::Level::Scalar;
+}
+
+
+/// Level and kernels in use
+struct Dispatch {
+    SimdSearch::Level level;
+    const Kernels *kernels;
+};
+
+
+/// Kernels in use. The CPU is checked at the first call, so the searches work from any static initializer
+static Dispatch& dispatch() {
+    static Dispatch state = [] {
+        SimdSearch::Level level = detectLevel();
+        return Dispatch{level, kernelsOf(level)};
+    }();
+    return state;
+}
+
+
+/// Return index of the first element equal to the value or -1
+int SimdSearch::find(const int *data, unsigned size, int value) {
+    return dispatch().kernels->find(data, size, value);
+}
+
+
+/// Return amount of elements equal to the value
+unsigned SimdSearch::count(const int *data, unsigned size, int value) {
+    return dispatch().kernels->count(data, size, value);
+}
+
+
+/**
+ * Write indexes of all the elements equal to the value
+ * @param[in] data - array to search in
+ * @param[in] size - amount of elements
+ * @param[in] value - value to search for
+ * @param[out] indexes - found indexes in ascending order. Must fit count(data, size, value) elements
+ * @return amount of found elements
+ */
+unsigned SimdSearch::findAll(const int *data, unsigned size, int value, int *indexes) {
+    return dispatch().kernels->findAll(data, size, value, indexes);
+}
+
+
+/// Return the smallest element (size > 0)
+int SimdSearch::min(const int *data, unsigned size) {
+    return dispatch().kernels->min(data, size);
+}
+
+
+/// Return the largest element (size > 0)
+int SimdSearch::max(const int *data, unsigned size) {
+    return dispatch().kernels->max(data, size);
+}
+
+
+/**
+ * Check if the array contains at least one of the values. Up to HASHED_KEYS values are compared
+ * with every element by the vector kernels, larger sets are hashed and looked up per element
+ * @param[in] data - array to search in
+ * @param[in] size - amount of elements
+ * @param[in] values - values to search for
+ * @param[in] count - amount of values
+ */
+bool SimdSearch::containsAny(const int *data, unsigned size, const int *values, unsigned count) {
+    if (count <= HASHED_KEYS) return dispatch().kernels->containsAny(data, size, values, count);
+
+    const KeySet set(values, count);
+    for (unsigned i = 0; i < size; ++i)
+        if (set.find(data[i]) != -1) return true;
+    return false;
+}
+
+
+/**
+ * Find the first occurrence of each key in one pass over the array. The array is walked by blocks
+ * that stay in L1 cache and every key that isn't found yet is searched in the block, so the compute
+ * is O(size * count) while memory is read once. Sets of more than HASHED_KEYS keys are hashed instead:
+ * every element is looked up once, O(size + count)
+ * @param[in] data - array to search in
+ * @param[in] size - amount of elements
+ * @param[in] keys - values to search for
+ * @param[in] count - amount of keys
+ * @param[out] indexes - index of the first occurrence of each key or -1
+ */
+void SimdSearch::findBatch(const int *data, unsigned size, const int *keys, unsigned count, int *indexes) {
+    if (count > HASHED_KEYS) {
+        const KeySet set(keys, count);
+        std::vector<int> first(set.getCapacity(), -1);  // By the slot of the key
+        unsigned left = set.getSize();
+        for (unsigned i = 0; i < size && left; ++i) {
+            int slot = set.find(data[i]);
+            if (slot != -1 && first[slot] == -1) {
+                first[slot] = int(i);
+                left--;
+            }
+        }
+        for (unsigned k = 0; k < count; ++k) indexes[k] = first[set.find(keys[k])];
+        return;
+    }
+
+    const Kernels *kernels = dispatch().kernels;
+    std::fill(indexes, indexes + count, -1);
+
+    unsigned left = count;
+    for (unsigned start = 0; start < size && left; start += BLOCK_SIZE) {
+        unsigned length = std::min(BLOCK_SIZE, size - start);
+        for (unsigned k = 0; k < count; ++k) {
+            if (indexes[k] != -1) continue;
+            int index = kernels->find(data + start, length, keys[k]);
+            if (index != -1) {
+                indexes[k] = int(start) + index;
+                left--;
+            }
+        }
+    }
+}
+
+
+/// Return the level of the kernels in use
+SimdSearch::Level SimdSearch::getLevel() {
+    return dispatch().level;
+}
+
+
+/// Use the kernels of the given level. Return false if the CPU doesn't support it
+bool SimdSearch::setLevel(Level level) {
+    if (!isSupported(level)) return false;
+    dispatch() = {level, kernelsOf(level)};
+    return true;
+}
+
+
+/// Return true if the CPU supports the level
+bool SimdSearch::isSupported(Level level) {
+#ifdef SIMD_SEARCH_X86
+    __builtin_cpu_init();  // May be called by static initializers before the runtime has done it
+    if (level == Level::AVX2) return __builtin_cpu_supports("avx2");
+    if (level == Level::SSE41) return __builtin_cpu_supports("sse4.1");
+#endif
+    return level == Level::Scalar;
+}
+
+
+/// Return the name of the level
+const char * SimdSearch::getLevelName(Level level) {
+    switch (level) {
+        case Level::AVX2: return "AVX2";
+        case Level::SSE41: return "SSE4.1";
+        default: return "Scalar";
+    }
+}
@@ -0,0 +1,30 @@
+#ifndef PRACTICE01_SIMD_SEARCH_H
+#define PRACTICE01_SIMD_SEARCH_H
+
+
+/**
+ * @class SimdSearch
+ * @brief Search kernels over arrays of int
+ * Every kernel has AVX2, SSE4.1 and portable scalar versions. The best one supported by the CPU
+ * is chosen at the first call, setLevel() may force a lower one (e.g. to compare them)
+ */
+class SimdSearch {
+public:
+    enum class Level { Scalar, SSE41, AVX2 };
+
+    static int find(const int*, unsigned, int);
+    static unsigned count(const int*, unsigned, int);
+    static unsigned findAll(const int*, unsigned, int, int*);
+    static int min(const int*, unsigned);
+    static int max(const int*, unsigned);
+    static bool containsAny(const int*, unsigned, const int*, unsigned);
+    static void findBatch(const int*, unsigned, const int*, unsigned, int*);
+
+    static Level getLevel();
+    static bool setLevel(Level);
+    static bool isSupported(Level);
+    static const char * getLevelName(Level);
+};
+
+
+#endif //PRACTICE01_SIMD_SEARCH_H
@@ -0,0 +1,316 @@
+#ifndef PRACTICE01_SORTED_ARRAY_H
+#define PRACTICE01_SORTED_ARRAY_H
+
+#include "dynamic_array.h"
+#include <algorithm>
+#include <bit>
+#include <iostream>
+
+// Prefetch hint for the search, ignored by the compilers that don't have it
+#if defined(__GNUC__)
+#define SORTED_ARRAY_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define SORTED_ARRAY_PREFETCH(address)
+#endif
+
+
+/**
+ * @class SortedDArray
+ * @brief Sorted dynamic array with a cache-friendly search index
+ * Besides the sorted elements the array keeps their copy in Eytzinger (BFS) order: the root of the
+ * implicit search tree is at 1, children of k are at 2k and 2k+1. The first levels of the tree share a few
+ * cache lines and the search prefetches the node four levels below, so a lookup takes about one cache miss
+ * per four levels instead of one per level of the binary search. Every change rebuilds the index in O(n),
+ * the same order as the shift of the sorted elements, so the searches never change the array and
+ * a const array may be searched by several threads at once
+ * @tparam T - type of the values, compared with < and ==
+ */
+template <typename T>
+class SortedDArray {
+public:
+    /// Batch searches walk this many keys down the tree at once to overlap their cache misses
+    static constexpr unsigned BATCH_WIDTH = 8;
+
+private:
+    DArray<T> sorted;
+    DArray<T> layout;         // Eytzinger order, layout[0] is unused
+    DArray<unsigned> ranks;   // Index in 'sorted' of every layout node
+
+    void build();
+    unsigned build(unsigned, unsigned);
+    [[nodiscard]] unsigned descend(const T&) const;
+    static unsigned leave(unsigned);
+public:
+    // Constructors
+    SortedDArray();
+    explicit SortedDArray(unsigned, const T*);
+    explicit SortedDArray(const DArray<T>&);
+
+    // Operators
+    const T * operator[] (int) const;
+
+    // Iterators
+    [[nodiscard]] const T * begin() const;
+    [[nodiscard]] const T * end() const;
+
+    // Methods
+    const T * get(int) const;
+    void insert(const T&);
+    bool remove(const T&);
+    void clear();
+    [[nodiscard]] unsigned lower_bound(const T&) const;
+    [[nodiscard]] bool contains(const T&) const;
+    [[nodiscard]] DArray<T> range(const T&, const T&) const;
+    [[nodiscard]] DArray<unsigned> lower_bound(const DArray<T>&) const;
+    [[nodiscard]] DArray<bool> contains(const DArray<T>&) const;
+    [[nodiscard]] unsigned getSize() const;
+    [[nodiscard]] bool isEmpty() const;
+};
+
+
+/// Rebuild the Eytzinger layout from the sorted elements
+template <typename T>
+void SortedDArray<T>::build() {
+    unsigned size = sorted.getSize();
+    layout = DArray<T>(size + 1);
+    ranks = DArray<unsigned>(size + 1, size);
+    build(1, 0);
+}
+
+
+/**
+ * Fill the subtree of the node in order
+ * @param[in] node - index of the subtree root in the layout
+ * @param[in] rank - index of the first sorted element the subtree takes
+ * @return index of the first sorted element after the subtree
+ */
+template <typename T>
+unsigned SortedDArray<T>::build(unsigned node, unsigned rank) {
+    if (node > sorted.getSize()) return rank;
+    rank = build(2 * node, rank);
+    layout.data()[node] = sorted.data()[rank];
+    ranks.data()[node] = rank;
+    return build(2 * node + 1, rank + 1);
+}
+
+
+/**
+ * Walk the tree from the root to a leaf, going right while the node is less than the value
+ * @param[in] value - value to look for
+ * @return the node past the leaf, leave() turns it into the lower bound node
+ */
+template <typename T>
+unsigned SortedDArray<T>::descend(const T &value) const {
+    const T *nodes = layout.data();
+    unsigned size = sorted.getSize();
+    constexpr unsigned ahead = std::max(64 / unsigned(sizeof(T)), 1u);
+
+    unsigned node = 1;
+    while (node <= size) {
+        SORTED_ARRAY_PREFETCH(nodes + std::min<unsigned long long>((unsigned long long)node * ahead, size));
+        node = 2 * node + (nodes[node] < value);
+    }
+    return node;
+}
+
+
+/// The last left turn of the path: drop the trailing right turns and the left one. 0 if there was none
+template <typename T>
+unsigned SortedDArray<T>::leave(unsigned node) {
+    return node >> (std::countr_one(node) + 1);
+}
+
+
+/// Default constructor. Creates empty array
+template <typename T>
+SortedDArray<T>::SortedDArray() {
+    build();
+}
+
+
+/// Creates sorted array by array values
+template <typename T>
+SortedDArray<T>::SortedDArray(unsigned n, const T *values) : sorted(n, values) {
+    std::sort(sorted.begin(), sorted.end());
+    build();
+}
+
+
+/// Creates sorted array by the values of the dynamic array
+template <typename T>
+SortedDArray<T>::SortedDArray(const DArray<T> &values) : sorted(values) {
+    std::sort(sorted.begin(), sorted.end());
+    build();
+}
+
+
+/// Print the array
+template <typename T>
+std::ostream& operator<< (std::ostream& os, const SortedDArray<T>& arr) {
+    for (const T &value : arr)
+        os << value << ' ';
+    return os;
+}
+
+
+/// Get element by it`s index in the sorted order via [] operator
+template <typename T>
+const T * SortedDArray<T>::operator[] (int index) const {
+    return get(index);
+}
+
+
+/// Pointer to the smallest element
+template <typename T>
+const T * SortedDArray<T>::begin() const {
+    return sorted.begin();
+}
+
+
+/// Pointer past the largest element
+template <typename T>
+const T * SortedDArray<T>::end() const {
+    return sorted.end();
+}
+
+
+/// Get element by it`s index in the sorted order. Negative index counts from the end
+template <typename T>
+const T * SortedDArray<T>::get(int index) const {
+    return const_cast<DArray<T>&>(sorted).get(index);
+}
+
+
+/// Insert the value keeping the order. Equal values go after the existing ones
+template <typename T>
+void SortedDArray<T>::insert(const T &value) {
+    unsigned index = unsigned(std::upper_bound(sorted.begin(), sorted.end(), value) - sorted.begin());
+    if (index == sorted.getSize()) sorted.append(value);
+    else sorted.insert(index, value);
+    build();
+}
+
+
+/// Remove one element equal to the value. Return true if it was found
+template <typename T>
+bool SortedDArray<T>::remove(const T &value) {
+    const T *found = std::lower_bound(sorted.begin(), sorted.end(), value);
+    if (found == sorted.end() || !(*found == value)) return false;
+
+    sorted.remove(unsigned(found - sorted.begin()));
+    build();
+    return true;
+}
+
+
+/// Remove all the elements
+template <typename T>
+void SortedDArray<T>::clear() {
+    sorted.clear();
+    build();
+}
+
+
+/**
+ * Find the first element that isn't less than the value
+ * @param[in] value - value to look for
+ * @return index of the element in the sorted order, size if all the elements are less
+ */
+template <typename T>
+unsigned SortedDArray<T>::lower_bound(const T &value) const {
+    unsigned node = leave(descend(value));
+    return node ? ranks.data()[node] : sorted.getSize();
+}
+
+
+/// Return true if the value is in the array
+template <typename T>
+bool SortedDArray<T>::contains(const T &value) const {
+    unsigned node = leave(descend(value));
+    return node && layout.data()[node] == value;
+}
+
+
+/**
+ * Copy the elements in [low, high)
+ * @param[in] low - smallest value to copy
+ * @param[in] high - value after the largest one to copy
+ * @return sorted elements in the range
+ */
+template <typename T>
+DArray<T> SortedDArray<T>::range(const T &low, const T &high) const {
+    unsigned first = lower_bound(low);
+    unsigned last = std::max(lower_bound(high), first);
+    return DArray<T>(last - first, sorted.data() + first);
+}
+
+
+/**
+ * Lower bounds of many values. Several searches go down the tree together, so their cache misses overlap
+ * @param[in] values - values to look for
+ * @return index of the lower bound of every value (see lower_bound())
+ */
+template <typename T>
+DArray<unsigned> SortedDArray<T>::lower_bound(const DArray<T> &values) const {
+    const T *nodes = layout.data();
+    const T *keys = values.data();
+    unsigned size = sorted.getSize();
+    unsigned count = values.getSize();
+    constexpr unsigned ahead = std::max(64 / unsigned(sizeof(T)), 1u);
+    DArray<unsigned> bounds(count, size);
+
+    for (unsigned first = 0; first < count; first += BATCH_WIDTH) {
+        unsigned width = std::min(BATCH_WIDTH, count - first);
+        unsigned path[BATCH_WIDTH];
+        std::fill(path, path + width, 1u);
+
+        // Every path has the same length up to one level
+        for (bool isWalking = true; isWalking;) {
+            isWalking = false;
+            for (unsigned j = 0; j < width; ++j) {
+                if (path[j] > size) continue;
+                SORTED_ARRAY_PREFETCH(nodes + std::min<unsigned long long>((unsigned long long)path[j] * ahead, size));
+                path[j] = 2 * path[j] + (nodes[path[j]] < keys[first + j]);
+                isWalking = true;
+            }
+        }
+
+        for (unsigned j = 0; j < width; ++j)
+            if (unsigned node = leave(path[j])) bounds.data()[first + j] = ranks.data()[node];
+    }
+    return bounds;
+}
+
+
+/**
+ * Membership of many values, searched together like in the batch lower_bound()
+ * @param[in] values - values to look for
+ * @return true for every value that is in the array
+ */
+template <typename T>
+DArray<bool> SortedDArray<T>::contains(const DArray<T> &values) const {
+    DArray<unsigned> bounds = lower_bound(values);
+    DArray<bool> found(values.getSize(), false);
+    for (unsigned i = 0; i < values.getSize(); ++i) {
+        unsigned bound = bounds.data()[i];
+        found.data()[i] = bound < sorted.getSize() && sorted.data()[bound] == values.data()[i];
+    }
+    return found;
+}
+
+
+/// Return the amount of elements
+template <typename T>
+unsigned SortedDArray<T>::getSize() const {
+    return sorted.getSize();
+}
+
+
+/// Return true if the array has no elements
+template <typename T>
+bool SortedDArray<T>::isEmpty() const {
+    return sorted.isEmpty();
+}
+
+
+#endif //PRACTICE01_SORTED_ARRAY_H
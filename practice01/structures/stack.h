@@ -2,28 +2,161 @@
 #define PRACTICE01_STACK_H
 
 
-#include <forward_list>
+#include "dynamic_array.h"
+#include <stdexcept>
 #include <string>
+#include <utility>
 #include <iostream>
 
+
+/**
+ * @class Stack
+ * @brief LIFO stack on a contiguous array
+ * Elements are stored in a DArray, so a push takes no allocation until the capacity is exceeded
+ * and reserve() removes even that. With N > 0 the stack has a fixed capacity of N elements stored
+ * inside the object: it never allocates and push() over N throws std::overflow_error
+ * @tparam T - type of the values
+ * @tparam N - fixed capacity, 0 for a growing stack (def. = 0)
+ */
+template <typename T, unsigned N = 0>
 class Stack {
 private:
-    std::forward_list<std::string> items;
-    int size = 0;
-public:
-    // Constructors and destructor
+    DArray<T, N> items;  // Bottom first
 
+    void check(unsigned) const;
+public:
+    static constexpr bool isFixed = N > 0;
 
     // Operators
-    friend std::ostream& operator<< (std::ostream&, const Stack&);
+    template <typename U, unsigned M>
+    friend std::ostream& operator<< (std::ostream&, const Stack<U, M>&);
 
     // Methods
-    void push(std::string &value);
-    std::string pop();
-    std::string * top();
+    void push(const T&);
+    void push(T&&);
+    template <typename... Args>
+    T& emplace(Args&&...);
+    T pop();
+    T * top();
+    void reserve(unsigned);
+    void clear();
     [[nodiscard]] unsigned getSize() const;
+    [[nodiscard]] unsigned getCapacity() const;
     [[nodiscard]] bool isEmpty() const;
+    [[nodiscard]] const Stats& getStats() const;
+    void resetStats();
 };
 
 
+/// Throw std::overflow_error if the fixed stack can't hold the amount of elements
+template <typename T, unsigned N>
+void Stack<T, N>::check(unsigned size) const {
+    if (isFixed && size > N) throw std::overflow_error("Stack capacity exceeded: " + std::to_string(N));
+}
+
+
+/// Print the stack from the top
+template <typename U, unsigned M>
+std::ostream& operator<< (std::ostream& os, const Stack<U, M>& stack) {
+    for (const U *it = stack.items.end(); it != stack.items.begin();)
+        os << *--it << ' ';
+    return os;
+}
+
+
+/// Add copy of the element to the top of the stack
+template <typename T, unsigned N>
+void Stack<T, N>::push(const T &value) {
+    emplace(value);
+}
+
+
+/// Move the element to the top of the stack
+template <typename T, unsigned N>
+void Stack<T, N>::push(T &&value) {
+    emplace(std::move(value));
+}
+
+
+/**
+ * Construct the element in place on the top of the stack
+ * @param[in] args - arguments forwarded to the constructor of T
+ * @return reference to the new top
+ */
+template <typename T, unsigned N>
+template <typename... Args>
+T& Stack<T, N>::emplace(Args&&... args) {
+    check(items.getSize() + 1);
+    return items.emplace_back(std::forward<Args>(args)...);
+}
+
+
+/// Move the top item out of the stack and return it. Empty stack returns T()
+template <typename T, unsigned N>
+T Stack<T, N>::pop() {
+    if (isEmpty()) return T();
+    T item = std::move(*items.get(-1));
+    items.remove(items.getSize() - 1);
+    return item;
+}
+
+
+/// Return top item without removing it
+template <typename T, unsigned N>
+T * Stack<T, N>::top() {
+    if (isEmpty()) return nullptr;
+    return items.data() + items.getSize() - 1;
+}
+
+
+/// Make sure that the stack holds at least the given amount of elements without allocation
+template <typename T, unsigned N>
+void Stack<T, N>::reserve(unsigned capacity) {
+    check(capacity);
+    items.reserve(capacity);
+}
+
+
+/// Remove all the elements. The storage is kept
+template <typename T, unsigned N>
+void Stack<T, N>::clear() {
+    items.clear();
+}
+
+
+/// Return size of the stack
+template <typename T, unsigned N>
+unsigned Stack<T, N>::getSize() const {
+    return items.getSize();
+}
+
+
+/// Return the amount of elements the stack holds without allocation
+template <typename T, unsigned N>
+unsigned Stack<T, N>::getCapacity() const {
+    return items.getCapacity();
+}
+
+
+/// Return true if stack is empty
+template <typename T, unsigned N>
+bool Stack<T, N>::isEmpty() const {
+    return items.isEmpty();
+}
+
+
+/// Return the counters of the stack (empty unless ADS_STATS is defined)
+template <typename T, unsigned N>
+const Stats& Stack<T, N>::getStats() const {
+    return items.getStats();
+}
+
+
+/// Reset the counters of the stack
+template <typename T, unsigned N>
+void Stack<T, N>::resetStats() {
+    items.resetStats();
+}
+
+
 #endif //PRACTICE01_STACK_H
@@ -0,0 +1,73 @@
+#ifndef PRACTICE01_STATS_H
+#define PRACTICE01_STATS_H
+
+#include <iostream>
+#include <algorithm>
+#include <cstddef>
+
+
+/**
+ * @struct Stats
+ * @brief Memory and operation counters of a container
+ * Counting is compiled in only if ADS_STATS is defined (see the ADS_STATS CMake option).
+ * Otherwise the struct is empty, every method does nothing and containers keep their size
+ */
+struct Stats {
+#ifdef ADS_STATS
+    static constexpr bool isEnabled = true;
+
+    unsigned long long allocations = 0;     // Requests of the element storage
+    unsigned long long allocatedBytes = 0;  // Bytes requested in total
+    unsigned long long freedBytes = 0;      // Bytes returned in total
+    unsigned long long peakSize = 0;        // Largest amount of elements
+    unsigned long long reallocations = 0;   // Times the storage was moved to a new buffer
+    unsigned long long getSteps = 0;        // Nodes walked by get()
+    unsigned long long iteratorSteps = 0;   // Increments and decrements of the iterators
+
+    void allocated(std::size_t bytes, unsigned long long count = 1) { allocations += count; allocatedBytes += bytes; }
+    void freed(std::size_t bytes) { freedBytes += bytes; }
+    void sized(unsigned long long size) { peakSize = std::max(peakSize, size); }
+    void reallocated() { reallocations++; }
+    void walked(unsigned long long steps) { getSteps += steps; }
+    void stepped() { iteratorSteps++; }
+
+    /// Add the counters of the other container, e.g. when it's nodes are taken
+    Stats& operator+= (const Stats &rhs) {
+        allocations += rhs.allocations;
+        allocatedBytes += rhs.allocatedBytes;
+        freedBytes += rhs.freedBytes;
+        peakSize = std::max(peakSize, rhs.peakSize);
+        reallocations += rhs.reallocations;
+        getSteps += rhs.getSteps;
+        iteratorSteps += rhs.iteratorSteps;
+        return *this;
+    }
+#else
+    static constexpr bool isEnabled = false;
+
+    void allocated(std::size_t, unsigned long long = 1) {}
+    void freed(std::size_t) {}
+    void sized(unsigned long long) {}
+    void reallocated() {}
+    void walked(unsigned long long) {}
+    void stepped() {}
+    Stats& operator+= (const Stats&) { return *this; }
+#endif
+};
+
+
+/// Print the counters
+inline std::ostream& operator<< (std::ostream &os, [[maybe_unused]] const Stats &stats) {
+#ifdef ADS_STATS
+    os << "Allocations: " << stats.allocations;
+    os << "; bytes allocated: " << stats.allocatedBytes << ", freed: " << stats.freedBytes << '\n';
+    os << "Peak size: " << stats.peakSize << "; reallocations: " << stats.reallocations << '\n';
+    os << "get() steps: " << stats.getSteps << "; iterator steps: " << stats.iteratorSteps << '\n';
+#else
+    os << "Statistics are disabled. Build with -DADS_STATS=ON\n";
+#endif
+    return os;
+}
+
+
+#endif //PRACTICE01_STATS_H
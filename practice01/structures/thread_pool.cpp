@@ -0,0 +1,99 @@
+#include "thread_pool.h"
+
+#include <algorithm>
+
+
+/**
+ * Start the workers. The thread that calls run() is one of the threads
+ * @param[in] threads - total amount of threads (def. = amount of cores)
+ */
+ThreadPool::ThreadPool(unsigned threads) {
+    threads = std::max(threads, 1u);
+    _workers.reserve(threads - 1);
+    for (unsigned i = 1; i < threads; ++i)
+        _workers.emplace_back(&ThreadPool::work, this);
+}
+
+
+/// Stop and join the workers
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard lock(_mutex);
+        _isStopping = true;
+    }
+    _wake.notify_all();
+    for (std::thread &worker : _workers) worker.join();
+}
+
+
+/// Worker loop: sleep until the next run, take its tasks, report the end
+void ThreadPool::work() {
+    unsigned long long seen = 0;
+    while (true) {
+        {
+            std::unique_lock lock(_mutex);
+            _wake.wait(lock, [&] { return _isStopping || _generation != seen; });
+            if (_isStopping) return;
+            seen = _generation;
+        }
+
+        drain();
+
+        std::lock_guard lock(_mutex);
+        if (--_busy == 0) _done.notify_one();
+    }
+}
+
+
+/// Take and run the tasks until there are none left
+void ThreadPool::drain() {
+    for (unsigned index = _next.fetch_add(1); index < _taskCount; index = _next.fetch_add(1))
+        _task(_context, index);
+}
+
+
+/**
+ * Run the tasks on all the threads and wait for them
+ * @param[in] taskCount - amount of tasks
+ * @param[in] task - function called with the context and the number of the task
+ * @param[in] context - pointer passed to the task
+ */
+void ThreadPool::execute(unsigned taskCount, Task task, void *context) {
+    if (taskCount == 0) return;
+    std::lock_guard runLock(_runMutex);
+
+    // Single task or no workers, nothing to wake
+    if (taskCount == 1 || _workers.empty()) {
+        for (unsigned i = 0; i < taskCount; ++i) task(context, i);
+        return;
+    }
+
+    {
+        std::lock_guard lock(_mutex);
+        _task = task;
+        _context = context;
+        _taskCount = taskCount;
+        _next.store(0);
+        _busy = unsigned(_workers.size());
+        _generation++;
+    }
+    _wake.notify_all();
+
+    drain();
+
+    std::unique_lock lock(_mutex);
+    _done.wait(lock, [&] { return _busy == 0; });
+}
+
+
+/// Return the total amount of threads, including the caller of run()
+unsigned ThreadPool::getThreadCount() const {
+    return unsigned(_workers.size()) + 1;
+}
+
+
+/// Pool of all the cores shared by the parallel algorithms. Started at the first call
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
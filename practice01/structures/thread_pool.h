@@ -0,0 +1,70 @@
+#ifndef PRACTICE01_THREAD_POOL_H
+#define PRACTICE01_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+/**
+ * @class ThreadPool
+ * @brief Persistent worker threads that run numbered tasks
+ * run() hands out the task numbers through an atomic counter, so the threads balance the load themselves.
+ * The calling thread works too and returns when every task is done. Workers sleep between the runs.
+ * run() must not be called from inside a task
+ */
+class ThreadPool {
+private:
+    using Task = void (*)(void*, unsigned);
+
+    std::vector<std::thread> _workers;
+    std::mutex _runMutex;  // One run() at a time
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::condition_variable _done;
+
+    Task _task = nullptr;
+    void *_context = nullptr;
+    unsigned _taskCount = 0;
+    alignas(64) std::atomic<unsigned> _next = 0;  // Number of the next task to take
+    unsigned long long _generation = 0;           // Number of the run, wakes the workers
+    unsigned _busy = 0;                           // Workers that haven't finished the run
+    bool _isStopping = false;
+
+    void work();
+    void drain();
+    void execute(unsigned, Task, void*);
+public:
+    // Constructors and destructor
+    explicit ThreadPool(unsigned threads = std::thread::hardware_concurrency());
+    ThreadPool(const ThreadPool&) = delete;
+    ~ThreadPool();
+
+    // Operators
+    ThreadPool& operator= (const ThreadPool&) = delete;
+
+    // Methods
+    template <typename Func>
+    void run(unsigned, Func&&);
+    [[nodiscard]] unsigned getThreadCount() const;
+    static ThreadPool& shared();
+};
+
+
+/**
+ * Call func(i) for every i in [0, taskCount) on the pool threads and wait for all of them
+ * @param[in] taskCount - amount of tasks
+ * @param[in] func - callable that takes the number of the task
+ */
+template <typename Func>
+void ThreadPool::run(unsigned taskCount, Func &&func) {
+    using Callable = std::remove_reference_t<Func>;
+    execute(taskCount, [](void *context, unsigned index) { (*static_cast<Callable*>(context))(index); },
+            const_cast<void*>(static_cast<const void*>(&func)));
+}
+
+
+#endif //PRACTICE01_THREAD_POOL_H
@@ -0,0 +1,269 @@
+#include "unrolled_list.h"
+
+#include <iostream>
+#include <algorithm>
+
+
+/// Default constructor. Size = 0, head & tail = nullptr
+UnrolledList::UnrolledList() = default;
+
+
+/**
+ * Create unrolled list filled with given numbers
+ * @param[in] size - amount of values
+ * @param[in] values - int values of list
+ */
+UnrolledList::UnrolledList(unsigned size, const int *values) {
+    for (unsigned i = 0; i < size; ++i)
+        append(values[i]);
+}
+
+
+/**
+ * Deep copy constructor. Chunks are copied as they are
+ * @param[in] other - list from which the copy is taken
+ */
+UnrolledList::UnrolledList(const UnrolledList &other) {
+    *this = other;
+}
+
+
+/// Free the memory allocated for the chunks
+UnrolledList::~UnrolledList() {
+    clear();
+}
+
+
+/// Assignment operator
+UnrolledList& UnrolledList::operator= (const UnrolledList &rhs) {
+    // Self-assignment handler
+    if (this == &rhs) return *this;
+
+    // Clear the existing list
+    clear();
+
+    // Copy chunks from rhs to this list
+    for (struct Chunk *current = rhs._head; current; current = current->next) {
+        auto *chunk = new struct Chunk(*current);
+        chunk->next = nullptr;
+        chunk->prev = _tail;
+        _tail ? _tail->next = chunk : _head = chunk;
+        _tail = chunk;
+    }
+    _size = rhs._size;
+
+    return *this;
+}
+
+
+/// Print the list
+std::ostream& operator<< (std::ostream &os, const UnrolledList &list) {
+    for (int value : list)
+        os << value << ' ';
+    return os;
+}
+
+
+/// Get value by it's index via [] operator
+int * UnrolledList::operator[] (int index) {
+    return get(index);
+}
+
+
+/// Iterator to the first value
+UnrolledList::Iterator UnrolledList::begin() const {
+    return {_head, 0};
+}
+
+
+/// Iterator past the last value
+UnrolledList::Iterator UnrolledList::end() const {
+    return {nullptr, 0};
+}
+
+
+/// Clear the list. Set head & tail to nullptr
+void UnrolledList::clear() {
+    while (_head) {
+        struct Chunk *temp = _head;
+        _head = _head->next;
+        delete temp;
+    }
+    _tail = nullptr;
+    _size = 0;
+}
+
+
+/// Reverse the list. Order of chunks and values inside each chunk are reversed
+void UnrolledList::reverse() {
+    for (struct Chunk *current = _head; current; current = current->prev) {
+        std::reverse(current->values, current->values + current->count);
+        std::swap(current->next, current->prev);
+    }
+    std::swap(_head, _tail);
+}
+
+
+/**
+ * Find the chunk that holds the index-th value
+ * @param[in,out] index - index in the list. Becomes the offset inside the found chunk
+ * @return found chunk
+ */
+struct Chunk * UnrolledList::locate(unsigned &index) const {
+    struct Chunk *chunk = _head;
+    while (index >= chunk->count) {
+        index -= chunk->count;
+        chunk = chunk->next;
+    }
+    return chunk;
+}
+
+
+/// Move the upper half of the chunk to the new chunk placed after it. Return the new chunk
+struct Chunk * UnrolledList::split(struct Chunk *chunk) {
+    auto *newChunk = new struct Chunk;
+    unsigned half = chunk->count / 2;
+    newChunk->count = chunk->count - half;
+    std::copy(chunk->values + half, chunk->values + chunk->count, newChunk->values);
+    chunk->count = half;
+
+    // Link after the chunk
+    newChunk->prev = chunk;
+    newChunk->next = chunk->next;
+    chunk->next ? chunk->next->prev = newChunk : _tail = newChunk;
+    chunk->next = newChunk;
+
+    return newChunk;
+}
+
+
+/// Unlink the chunk from the list and free it
+void UnrolledList::unlink(struct Chunk *chunk) {
+    chunk->prev ? chunk->prev->next = chunk->next : _head = chunk->next;
+    chunk->next ? chunk->next->prev = chunk->prev : _tail = chunk->prev;
+    delete chunk;
+}
+
+
+/// Get value by it's index
+int * UnrolledList::get(int index) {
+    if (isEmpty()) {
+        std::cout << "IndexError: The list is empty\n";
+        return nullptr;
+    } else if (index >= int(getSize()) || index < -int(getSize())) {
+        std::cout << "IndexError: Index out of range\n";
+        return nullptr;
+    } else if (index < 0) {
+        index = int(getSize()) + index;
+    }
+
+    auto offset = unsigned(index);
+    struct Chunk *chunk = locate(offset);
+    return &chunk->values[offset];
+}
+
+
+/// Return index if element found else -1
+int UnrolledList::find(int value) const {
+    int index = 0;
+    for (struct Chunk *chunk = _head; chunk; chunk = chunk->next) {
+        for (unsigned i = 0; i < chunk->count; ++i)
+            if (chunk->values[i] == value) return index + int(i);
+        index += int(chunk->count);
+    }
+    return -1;
+}
+
+
+/// Add element to the end of the list. The tail chunk is filled up before a new one is created
+void UnrolledList::append(int value) {
+    if (!_tail || _tail->count == Chunk::CAPACITY) {
+        auto *chunk = new struct Chunk;
+        chunk->prev = _tail;
+        _tail ? _tail->next = chunk : _head = chunk;
+        _tail = chunk;
+    }
+
+    _tail->values[_tail->count++] = value;
+    _size++;
+}
+
+
+/// Add element to the specified position. A full chunk is split in two
+void UnrolledList::insert(unsigned index, int value) {
+    if (index >= _size) {
+        std::cout << "IndexError: Index out of range\n";
+        return;
+    }
+
+    unsigned offset = index;
+    struct Chunk *chunk = locate(offset);
+
+    // No free space in the chunk. Split it and choose the half to insert into
+    if (chunk->count == Chunk::CAPACITY) {
+        struct Chunk *upper = split(chunk);
+        if (offset > chunk->count) {
+            offset -= chunk->count;
+            chunk = upper;
+        }
+    }
+
+    // Shift the values inside the chunk and insert
+    std::copy_backward(chunk->values + offset, chunk->values + chunk->count, chunk->values + chunk->count + 1);
+    chunk->values[offset] = value;
+    chunk->count++;
+    _size++;
+}
+
+
+/// Remove element by it's index. A chunk that is less than half full is merged with the next one
+void UnrolledList::remove(unsigned index) {
+    if (index >= _size) {
+        std::cout << "IndexError: Index out of range\n";
+        return;
+    }
+
+    unsigned offset = index;
+    struct Chunk *chunk = locate(offset);
+    std::copy(chunk->values + offset + 1, chunk->values + chunk->count, chunk->values + offset);
+    chunk->count--;
+    _size--;
+
+    // Empty chunk. Free it
+    if (chunk->count == 0) {
+        unlink(chunk);
+        return;
+    }
+
+    // Merge with the next chunk if both fit into one
+    struct Chunk *next = chunk->next;
+    if (chunk->count < Chunk::CAPACITY / 2 && next && chunk->count + next->count <= Chunk::CAPACITY) {
+        std::copy(next->values, next->values + next->count, chunk->values + chunk->count);
+        chunk->count += next->count;
+        unlink(next);
+    }
+}
+
+
+/// Swap two values by their indexes
+void UnrolledList::swap(unsigned i1, unsigned i2) {
+    if (i1 == i2) return;
+
+    int *value1 = get(int(i1));
+    int *value2 = get(int(i2));
+    if (!value1 || !value2) return;
+
+    std::swap(*value1, *value2);
+}
+
+
+/// Return size of the list
+unsigned UnrolledList::getSize() const {
+    return _size;
+}
+
+
+/// Return false if list is empty else true
+bool UnrolledList::isEmpty() const {
+    return _size == 0;
+}
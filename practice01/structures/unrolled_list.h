@@ -0,0 +1,97 @@
+#ifndef PRACTICE01_UNROLLED_LIST_H
+#define PRACTICE01_UNROLLED_LIST_H
+
+#include <iostream>
+#include <iterator>
+#include <cstddef>
+
+
+/// Chunk of an Unrolled List. Holds up to CAPACITY values and fits one cache line
+struct alignas(64) Chunk {
+    static constexpr unsigned CAPACITY = (64 - 2 * sizeof(Chunk*) - sizeof(unsigned)) / sizeof(int);
+
+    struct Chunk *next = nullptr;
+    struct Chunk *prev = nullptr;
+    unsigned count = 0;
+    int values[CAPACITY] = {};
+};
+
+
+/**
+ * @class UnrolledList
+ * @brief Doubly-linked list of chunks, each storing several values
+ * Has the same interface as List. Chunks are split when they overflow on insert
+ * and merged with the neighbour when they become less than half full on remove
+ */
+class UnrolledList {
+public:
+    /// Forward iterator over the values
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const int*;
+        using reference = const int&;
+
+        Iterator() = default;
+
+        reference operator* () const { return _chunk->values[_offset]; }
+        pointer operator-> () const { return &_chunk->values[_offset]; }
+        Iterator& operator++ () {
+            if (++_offset == _chunk->count) {
+                _chunk = _chunk->next;
+                _offset = 0;
+            }
+            return *this;
+        }
+        Iterator operator++ (int) { Iterator temp = *this; ++*this; return temp; }
+        bool operator== (const Iterator &rhs) const { return _chunk == rhs._chunk && _offset == rhs._offset; }
+
+    private:
+        const struct Chunk *_chunk = nullptr;
+        unsigned _offset = 0;
+
+        Iterator(const struct Chunk *chunk, unsigned offset) : _chunk(chunk), _offset(offset) {}
+        friend class UnrolledList;
+    };
+
+private:
+    struct Chunk *_head = nullptr;
+    struct Chunk *_tail = nullptr;
+    unsigned _size = 0;
+
+    struct Chunk * locate(unsigned&) const;
+    struct Chunk * split(struct Chunk*);
+    void unlink(struct Chunk*);
+public:
+    // Constructors and destructor
+    UnrolledList();
+    explicit UnrolledList(unsigned, const int*);
+    UnrolledList(const UnrolledList&);
+    ~UnrolledList();
+
+    // Operators
+    UnrolledList& operator= (const UnrolledList&);
+    friend std::ostream& operator<< (std::ostream&, const UnrolledList&);
+    int * operator[] (int);
+
+    // Iterators
+    [[nodiscard]] Iterator begin() const;
+    [[nodiscard]] Iterator end() const;
+
+    // Methods
+    void clear();
+    void reverse();
+    int * get(int);
+    int find(int) const;
+    void append(int);
+    void insert(unsigned, int);
+    void remove(unsigned);
+    void swap(unsigned, unsigned);
+    [[nodiscard]] unsigned getSize() const;
+    [[nodiscard]] bool isEmpty() const;
+};
+
+
+#endif //PRACTICE01_UNROLLED_LIST_H
@@ -5,6 +5,8 @@
 #include <iostream>
 #include <iomanip>
 #include <chrono>
+#include <algorithm>
+#include <vector>
 
 /**
  * Reads the number input via cin
@@ -37,10 +39,8 @@ void printTimeDurationCast(auto start, bool isEndOfLine = true) {
 }
 
 
-bool isSorted(List &list) {
-    for (struct Node *curr = list[0]; curr; curr = curr->next)
-        if (curr->next && curr->value > curr->next->value) return false;
-    return true;
+bool isSorted(const List<int> &list) {
+    return std::is_sorted(list.begin(), list.end());
 }
 
 
@@ -52,7 +52,7 @@ int TApplication::execute() {
     int size;
     std::cout << "<< Enter the size of the list:\n>> ";
     if (!inputNumber(size, true, true)) return -1;
-    int values[size];
+    std::vector<int> values(size);
     std::cout << "<< Enter 0 to fill with random numbers or";
     std::cout << " enter " << size << " elements separated by space:\n>> ";
     bool isRandFill = false;
@@ -65,9 +65,8 @@ int TApplication::execute() {
     }
     if (isRandFill) for (auto &el : values) el = 1 + std::rand() % 1000;
 
-    // Create the list
-    List unsortedList(size, values);
-    List list(size, values);
+    // Create the list. Values are kept to reset the list
+    List<int> list(values);
     std::cout << "List created.\n";
 
 
@@ -81,22 +80,28 @@ int TApplication::execute() {
             // QuickSort
             case '1': {
                 std::cout << "Sorting via quickSort..\n";
+                list.resetStats();
                 auto start = std::chrono::steady_clock::now();
                 quickSort(list);
                 std::cout << "Sorted. Elapsed time: ";
                 printTimeDurationCast(start, false);
+                Stats stats = list.getStats();  // Before isSorted(), it's walk is counted too
                 std::cout << "; isSorted - " << isSorted(list) << std::endl;
+                if constexpr (Stats::isEnabled) std::cout << stats;
                 break;
             }
 
             // TimSort
             case '2': {
                 std::cout << "Sorting via timSort..\n";
+                list.resetStats();
                 auto start = std::chrono::steady_clock::now();
                 timSort(list);
                 std::cout << "Sorted. Elapsed time: ";
                 printTimeDurationCast(start, false);
+                Stats stats = list.getStats();  // Before isSorted(), it's walk is counted too
                 std::cout << "; isSorted - " << isSorted(list) << std::endl;
+                if constexpr (Stats::isEnabled) std::cout << stats;
                 break;
             }
 
@@ -141,8 +146,18 @@ int TApplication::execute() {
 
             // Reset list to the unsorted state
             case 'r': {
-                list = unsortedList;
-                std::cout << "List updated.\n";
+                auto start = std::chrono::steady_clock::now();
+                list.assign(values.begin(), values.end());
+                std::cout << "List updated. Elapsed time: ";
+                printTimeDurationCast(start);
+                break;
+            }
+
+            // Switch node storage between the heap and the pool
+            case 'a': {
+                bool isPooled = !list.isPooled();
+                list.setPooled(isPooled);
+                std::cout << "Nodes are allocated from the " << (isPooled ? "pool" : "heap") << ".\n";
                 break;
             }
 
@@ -173,6 +188,7 @@ void TApplication::help() {
     std::cout << "i: Insert element\n";
     std::cout << "p: Print list\n";
     std::cout << "r: Reset to the unsorted\n";
+    std::cout << "a: Toggle node allocator (heap/pool)\n";
     std::cout << std::setw(32) << std::setfill('-') << '\n';
     std::cout << "0: Exit\n";
     std::cout << std::setw(32) << std::setfill('-') << '\n';
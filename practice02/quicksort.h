@@ -2,34 +2,55 @@
 #define ADS_QUICKSORT_H
 
 #include "../practice01/structures/dl_list.h"
+#include <algorithm>
+#include <iterator>
 
 class QuickSortUtil {
 private:
-    static void quickSort(List&, int, int);
-    friend void quickSort(List &list);
+    static void quickSort(List<int>::iterator, List<int>::iterator, int);
+    friend void quickSort(List<int> &list);
 };
 
 
-void QuickSortUtil::quickSort(List &list, int first, int last) {
-    int mid = list[(first + last) / 2]->value;
-    int tmpFirst = first, tmpLast = last;
-    while (first < last) {
-        while (list[first]->value < mid) first++;
-        while (list[last]->value > mid) last--;
-        if (first <= last) {
-            list.swap(first, last);
-            first++;
-            last--;
+/**
+ * Sort the range [first, last] of the given size. Cursors only walk the range, values are swapped in place
+ * @param[in] first - cursor to the first element of the range
+ * @param[in] last - cursor to the last element of the range
+ * @param[in] size - amount of elements in the range
+ */
+void QuickSortUtil::quickSort(List<int>::iterator first, List<int>::iterator last, int size) {
+    while (size > 1) {
+        int mid = *std::next(first, size / 2);
+        List<int>::iterator left = first, right = last;
+        int i = 0, j = size - 1;
+        while (i <= j) {
+            while (*left < mid) ++left, ++i;
+            while (*right > mid) --right, --j;
+            if (i <= j) {
+                std::iter_swap(left, right);
+                ++left, ++i;
+                --right, --j;
+            }
+        }
+
+        // Recurse into the smaller part and loop over the larger one to keep the stack depth logarithmic
+        if (j + 1 < size - i) {
+            quickSort(first, right, j + 1);
+            first = left;
+            size -= i;
+        } else {
+            quickSort(left, last, size - i);
+            last = right;
+            size = j + 1;
         }
     }
-    if (tmpFirst < last) quickSort(list, tmpFirst, last);
-    if (first < tmpLast) quickSort(list, first, tmpLast);
 }
 
 
 /// Sort list via quick sort
-void quickSort(List &list) {
-    QuickSortUtil::quickSort(list, 0, int(list.getSize() - 1));
+void quickSort(List<int> &list) {
+    if (list.getSize() <= 1) return; // Nothing to do
+    QuickSortUtil::quickSort(list.begin(), std::prev(list.end()), int(list.getSize()));
 }
 
 #endif //ADS_QUICKSORT_H
\ No newline at end of file
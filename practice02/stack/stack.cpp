@@ -1,46 +1,101 @@
 #include "stack.h"
 #include <iostream>
+#include <utility>
 
 
-/// Print the stack
-std::ostream& operator<< (std::ostream& os, const Stack& stack) {
-    for (const auto& it : stack.items)
-        std::cout << it << "; ";
+/// Merge the runs at index and index + 1, the runs above them move down by one
+void RunStack::mergeAt(unsigned index) {
+    runs[index] = merge(std::move(runs[index]), std::move(runs[index + 1]));
+    if (index + 2 < size) runs[index + 1] = std::move(runs[index + 2]);
+    size--;
+}
+
+
+/// Length of the run by it's index from the bottom
+unsigned RunStack::lengthAt(unsigned index) const {
+    return runs[index].getSize();
+}
+
+
+/**
+ * Create empty stack
+ * @param[in] merge - stable merge of two sorted lists, the first one goes first in the list
+ */
+RunStack::RunStack(Merge merge) : merge(merge) {}
+
+
+/// Print the stack from the bottom
+std::ostream& operator<< (std::ostream& os, const RunStack& stack) {
+    for (unsigned i = 0; i < stack.size; ++i)
+        os << stack.runs[i] << "; ";
     return os;
 }
 
 
-/// Add element to the end of the stack
-void Stack::push(List &list) {
-    items.push_front(list);
-    size++;
+/**
+ * Move the run on the top of the stack and merge the top runs until the invariants hold.
+ * Besides the top three runs the fourth one is checked too, otherwise a merge below
+ * the top could break the invariant deeper in the stack
+ * @param[in] run - sorted run that follows the runs of the stack in the list
+ */
+void RunStack::push(List<int> &&run) {
+    runs[size++] = std::move(run);
+    stats.sized(size);
+
+    while (size > 1) {
+        unsigned n = size - 2;  // Merge candidate B, C is above it
+        if ((n > 0 && lengthAt(n - 1) <= lengthAt(n) + lengthAt(n + 1)) ||
+            (n > 1 && lengthAt(n - 2) <= lengthAt(n - 1) + lengthAt(n))) {
+            if (lengthAt(n - 1) < lengthAt(n + 1)) n--;  // Merge the shorter neighbour of B
+            mergeAt(n);
+        } else if (lengthAt(n) <= lengthAt(n + 1)) {
+            mergeAt(n);
+        } else break;
+    }
 }
 
 
-/// Return top item and remove it from stack
-List Stack::pop() {
-    if (isEmpty()) return List(0);
-    List list = items.front();
-    items.pop_front();
-    size--;
-    return list;
+/// Merge all the runs and take the result out of the stack. Empty stack returns an empty list
+List<int> RunStack::collapse() {
+    if (isEmpty()) return List<int>();
+
+    while (size > 1) {
+        unsigned n = size - 2;
+        if (n > 0 && lengthAt(n - 1) < lengthAt(n + 1)) n--;
+        mergeAt(n);
+    }
+
+    size = 0;
+    return std::move(runs[0]);
 }
 
 
-/// Return top item without removing it
-List * Stack::top() {
+/// Return top run without removing it
+List<int> * RunStack::top() {
     if (isEmpty()) return nullptr;
-    return &items.front();
+    return &runs[size - 1];
 }
 
 
-/// Return size of the stack
-unsigned Stack::getSize() const {
+/// Return amount of the runs
+unsigned RunStack::getSize() const {
     return size;
 }
 
 
-/// Return false if stack is empty else true
-bool Stack::isEmpty() const {
-    return items.empty();
-}
\ No newline at end of file
+/// Return true if stack is empty
+bool RunStack::isEmpty() const {
+    return size == 0;
+}
+
+
+/// Return the counters of the stack (empty unless ADS_STATS is defined)
+const Stats& RunStack::getStats() const {
+    return stats;
+}
+
+
+/// Reset the counters of the stack
+void RunStack::resetStats() {
+    stats = {};
+}
@@ -1,25 +1,51 @@
-#ifndef PRACTICE01_STACK_H
-#define PRACTICE01_STACK_H
+#ifndef PRACTICE02_STACK_H
+#define PRACTICE02_STACK_H
 
-#include <forward_list>
 #include <iostream>
 #include "../../practice01/structures/dl_list.h"
 
-class Stack {
+
+/**
+ * @class RunStack
+ * @brief Stack of the sorted runs of TimSort
+ * Runs are moved in and out, their nodes are never copied. The runs are kept in the order of the list,
+ * bottom first, and push() merges the top runs until the TimSort invariants hold for every three
+ * neighbouring runs A, B, C: |A| > |B| + |C| and |B| > |C|. So the lengths grow at least like Fibonacci
+ * numbers from the top, the stack never holds more than MAX_RUNS runs and lives inside the object
+ */
+class RunStack {
+public:
+    using Merge = List<int> (*)(List<int>&&, List<int>&&);
+
+    /// Enough for any list: the runs from the top are at least as long as the Fibonacci numbers
+    static constexpr unsigned MAX_RUNS = 48;
+
 private:
-    std::forward_list<List> items;
-    int size = 0;
+    List<int> runs[MAX_RUNS];
+    unsigned size = 0;
+    Merge merge;
+    [[no_unique_address]] Stats stats;  // Counters, empty unless ADS_STATS is defined
+
+    void mergeAt(unsigned);
+    [[nodiscard]] unsigned lengthAt(unsigned) const;
 public:
+    // Constructors
+    explicit RunStack(Merge);
+    RunStack(const RunStack&) = delete;
+
     // Operators
-    friend std::ostream& operator<< (std::ostream&, const Stack&);
+    RunStack& operator= (const RunStack&) = delete;
+    friend std::ostream& operator<< (std::ostream&, const RunStack&);
 
     // Methods
-    void push(List&);
-    List pop();
-    List * top();
+    void push(List<int>&&);
+    List<int> collapse();
+    List<int> * top();
     [[nodiscard]] unsigned getSize() const;
     [[nodiscard]] bool isEmpty() const;
+    [[nodiscard]] const Stats& getStats() const;
+    void resetStats();
 };
 
 
-#endif //PRACTICE01_STACK_H
+#endif //PRACTICE02_STACK_H
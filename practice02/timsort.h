@@ -3,28 +3,31 @@
 
 #include "../practice01/structures/dl_list.h"
 #include "stack/stack.h"
+#include <algorithm>
+#include <iterator>
 
 class TimSortUtils {
 private:
-    static void insertionSort(List&);
-    static int getMinRun(int);
-    static Stack getRuns(List&);
-    static int binarySearch(List&, int);
-    static List merge(List&, List&);
+    static void insertionSort(List<int>&);
+    static unsigned getMinRun(unsigned);
+    static void pushRuns(List<int>&, RunStack&);
+    static List<int>::iterator binarySearch(List<int>::iterator, List<int>::iterator, int, bool = true);
+    static List<int> merge(List<int>&&, List<int>&&);
 
-    friend void timSort(List &list);
+    friend void timSort(List<int> &list);
 };
 
 
-void TimSortUtils::insertionSort(List &list) {
-    for (int i = 1; i < list.getSize(); ++i)
-        for (int j = i; j > 0 && list[j - 1]->value > list[j]->value; --j)
-            list.swap(j, j-1);
+void TimSortUtils::insertionSort(List<int> &list) {
+    if (list.isEmpty()) return;
+    for (auto it = std::next(list.begin()); it != list.end(); ++it)
+        for (auto curr = it, prev = std::prev(it); curr != list.begin() && *prev > *curr; curr = prev--)
+            std::iter_swap(prev, curr);
 }
 
 
-int TimSortUtils::getMinRun(int n) {
-    int mask = 0;
+unsigned TimSortUtils::getMinRun(unsigned n) {
+    unsigned mask = 0;
     while (n >= 64) {
         mask |= n & 1;
         n >>= 1;
@@ -33,150 +36,116 @@ int TimSortUtils::getMinRun(int n) {
 }
 
 
-Stack TimSortUtils::getRuns(List &list) {
-    int size = (int) list.getSize();
-    int minRun = getMinRun(size);
-    Stack sorted;
+/**
+ * Cut the list into sorted runs of at least minRun elements and push them to the stack in order,
+ * the stack merges them as they come
+ * @param[in, out] list - list to cut, becomes empty
+ * @param[in, out] runs - stack to push to
+ */
+void TimSortUtils::pushRuns(List<int> &list, RunStack &runs) {
+    unsigned minRun = getMinRun(list.getSize());
 
-    for (int i = 0; i < size; ++i) {
-        List run;
-        run.append(list[i]->value);
-
-        // Collect ready-made runs
-        if (list[i]->value <= list[i+1]->value) {
-            // Ascending
-            while ((i < size - 1) && (list[i]->value <= list[i+1]->value))
-                run.append(list[++i]->value);
-        } else {
-            // Descending
-            while ((i < size - 1) && (list[i]->value > list[i+1]->value))
-                run.append(list[++i]->value);
-            run.reverse();  // Insertion sort works horribly with reverse arrays
-        }
+    while (!list.isEmpty()) {
+        // Measure the ready-made run
+        auto it = list.begin(), next = std::next(it);
+        unsigned length = 1;
+        bool isDescending = next != list.end() && *it > *next;
+        for (; next != list.end() && (*it > *next) == isDescending; it = next++)
+            length++;
 
         // If there are still elems in the list and the minRun isn't reached, add elements
-        while ((i < size - 1) && (run.getSize() < minRun))
-            run.append(list[++i]->value);
+        if (length < minRun) length = std::min(minRun, list.getSize());
 
+        // Cut the run off the list. Nodes are relinked, not copied
+        List<int> rest = list.split(length);
+        List<int> run = std::move(list);
+        list = std::move(rest);
+
+        if (isDescending) run.reverse();  // Insertion sort works horribly with reverse arrays
         insertionSort(run);
-        sorted.push(run);
+        runs.push(std::move(run));
     }
-
-    return sorted;
 }
 
 
-int TimSortUtils::binarySearch(List& list, int key) {
-    int left = 0;
-    int right = (int) list.getSize() - 1;
-
-    while (left <= right) {
-        int mid = left + (right - left) / 2;
-
-        struct Node *midNode = list[mid];
-        if (midNode->value == key) return mid;
-        else if (midNode->value < key) left = mid + 1;
-        else right = mid - 1;
+/**
+ * Find the first element greater than the key (or not less than it). Jumps 1, 2, 4... elements ahead and then
+ * does the binary search in the last jump, so the cursor walks O(k) nodes, where k is the distance to the result
+ * @param[in] first - cursor to the beginning of the sorted range
+ * @param[in] last - cursor to the end of the sorted range
+ * @param[in] key - value to search for
+ * @param[in] isUpper - skip the elements equal to the key if true, else stop at the first of them (def. = true)
+ * @return cursor to the first element after the key or last if there is no such one
+ */
+List<int>::iterator TimSortUtils::binarySearch(List<int>::iterator first, List<int>::iterator last, int key, bool isUpper) {
+    auto isBefore = [&](int value) { return isUpper ? value <= key : value < key; };
+
+    for (int step = 1; first != last && isBefore(*first); step *= 2) {
+        List<int>::iterator probe = first;
+        for (int i = 0; i < step && std::next(probe) != last; ++i) ++probe;
+
+        if (!isBefore(*probe)) {
+            return isUpper ? std::upper_bound(std::next(first), probe, key)
+                           : std::lower_bound(std::next(first), probe, key);
+        }
+        first = std::next(probe);
     }
-
-    return list[right]->value == key ? right : -1;
+    return first;
 }
 
 
-List TimSortUtils::merge(List &a, List &b) {
+/// Merge two sorted lists. Nodes of b are relinked into a, so no memory is allocated
+List<int> TimSortUtils::merge(List<int> &&a, List<int> &&b) {
     // Galloping magic number. 7 elems in a row is lower than the b[i] -> do "galloping"
     const unsigned short N = 7;
     unsigned short consecutive = 0;
     bool isFromA = true;
 
-    // The insert operation is times longer than the append operation,
-    // so it was decided to spend additional memory to speed up the merge. It also improves code readability
-    List result;
-    struct Node *aNode = a[0];
-    struct Node *bNode = b[0];
-
-    while (aNode && bNode) {
-        // Galloping. Find b[i] in a via binarySearch
+    List<int>::iterator aNode = a.begin();
+    while (aNode != a.end() && !b.isEmpty()) {
+        // Galloping. Skip the run of a or move the run of b at once
         if (consecutive == N) {
             consecutive = 0;
             if (isFromA) {
-                int insertWhile = binarySearch(a, bNode->value);
-                if (insertWhile < 0) continue;
-
-                for (; aNode && aNode->value <= a[insertWhile]->value; aNode = aNode->next)
-                    result.append(aNode->value);
-                result.append(bNode->value);
-                bNode = bNode->next;
+                aNode = binarySearch(aNode, a.end(), *b.begin());
             } else {
-                int insertWhile = binarySearch(b, aNode->value);
-                if (insertWhile < 0) continue;
-
-                for (; bNode && bNode->value <= b[insertWhile]->value; bNode = bNode->next)
-                    result.append(bNode->value);
-                result.append(aNode->value);
-                aNode = aNode->next;
+                // Only the elements less than aNode go before it, equal ones stay after it (stability)
+                a.splice(aNode, b, b.begin(), binarySearch(b.begin(), b.end(), *aNode, false));
             }
         } else {
-            if (aNode->value <= bNode->value) {
+            if (*aNode <= *b.begin()) {
                 if (isFromA) consecutive++;
                 else {
                     consecutive = 1;
                     isFromA = true;
                 }
-                result.append(aNode->value);
-                aNode = aNode->next;
+                ++aNode;
             } else {
                 if (!isFromA) consecutive++;
                 else {
                     consecutive = 1;
                     isFromA = false;
                 }
-                result.append(bNode->value);
-                bNode = bNode->next;
+                a.splice(aNode, b, b.begin());
             }
         }
     }
 
     // Add unused values
-    for (; aNode; aNode = aNode->next) result.append(aNode->value);
-    for (; bNode; bNode = bNode->next) result.append(bNode->value);
+    a.concat(std::move(b));
 
-    return result;
+    return std::move(a);
 }
 
 
 /// Sort list via tim sort
-void timSort(List &list) {
+void timSort(List<int> &list) {
     if (list.getSize() <= 1) return; // Nothing to do
 
-    Stack runs = TimSortUtils::getRuns(list);
-
-    List x = runs.pop();
-    List y = runs.pop();
-    List z = runs.pop();
-    while (!runs.isEmpty()) {
-        // X > Y + Z && Y > Z
-        if ((x.getSize() > y.getSize() + z.getSize()) && (y > z)) {
-            x = TimSortUtils::merge(y, x);
-            y = z;
-            z = runs.pop();
-        } else {
-            if (x < z) {
-                x = TimSortUtils::merge(x, y);
-                y = z;
-                z = runs.pop();
-            } else {
-                y = TimSortUtils::merge(z, y);
-                z = runs.pop();
-            }
-        }
-    }
-
-    // Unused values
-    if (!y.isEmpty()) x = TimSortUtils::merge(x, y);
-    if (!z.isEmpty()) x = TimSortUtils::merge(x, z);
-
-    list = x;
+    // Runs are merged while they are pushed, the stack keeps their lengths balanced
+    RunStack runs(TimSortUtils::merge);
+    TimSortUtils::pushRuns(list, runs);
+    list = runs.collapse();
 }
 
 